@@ -365,7 +365,7 @@ BackgroundIndex::loadProject(std::vector<std::string> MainFiles) {
     });
   Rebuilder.startLoading();
   // Load shards for all of the mainfiles.
-  const std::vector<LoadedShard> Result =
+  std::vector<LoadedShard> Result =
       loadIndexShards(MainFiles, IndexStorageFactory, CDB);
   size_t LoadedShards = 0;
   {
@@ -393,6 +393,8 @@ BackgroundIndex::loadProject(std::vector<std::string> MainFiles) {
       IndexedSymbols.update(URI::create(LS.AbsolutePath).toString(),
                             std::move(SS), std::move(RS), std::move(RelS),
                             LS.CountReferences);
+      // Only the metadata above is needed from now on.
+      LS.Shard.reset();
     }
   }
   Rebuilder.loadedShard(LoadedShards);
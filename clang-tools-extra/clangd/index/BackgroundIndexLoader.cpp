@@ -87,6 +87,10 @@ BackgroundIndexLoader::loadShard(PathRef StartSourceFile, PathRef DependentTU) {
     LS.HadErrors = IGN.Flags & IncludeGraphNode::SourceFlag::HadErrors;
   }
   assert(LS.Digest != FileDigest{{0}} && "Digest is empty?");
+  // The include graph has been turned into edges and metadata above. Drop it,
+  // as every shard of a large project would otherwise keep the URIs of all of
+  // its transitive includes alive until loading finishes.
+  LS.Shard->Sources.reset();
   return {LS, Edges};
 }
 
@@ -38,7 +38,7 @@ struct LoadedShard {
   /// Path to a TU that is depending on this shard.
   Path DependentTU;
   /// Will be nullptr when index storage couldn't provide a valid shard for
-  /// AbsolutePath.
+  /// AbsolutePath. Its Sources are consumed while loading and are always null.
   std::unique_ptr<IndexFileIn> Shard;
 };
 
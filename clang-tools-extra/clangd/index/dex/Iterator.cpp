@@ -27,21 +27,22 @@ public:
   explicit AndIterator(std::vector<std::unique_ptr<Iterator>> AllChildren)
       : Iterator(Kind::And), Children(std::move(AllChildren)) {
     assert(!Children.empty() && "AND iterator should have at least one child.");
-    // Establish invariants.
-    for (const auto &Child : Children)
-      ReachedEnd |= Child->reachedEnd();
-    sync();
     // When children are sorted by the estimateSize(), sync() calls are more
     // effective. Each sync() starts with the first child and makes sure all
     // children point to the same element. If any child is "above" the previous
     // ones, the algorithm resets and and advances the children to the next
     // highest element starting from the front. When child iterators in the
     // beginning have smaller estimated size, the sync() will have less restarts
-    // and become more effective.
+    // and become more effective. Sort before establishing the invariants, so
+    // that the initial sync() benefits from this as well.
     llvm::sort(Children, [](const std::unique_ptr<Iterator> &LHS,
                             const std::unique_ptr<Iterator> &RHS) {
       return LHS->estimateSize() < RHS->estimateSize();
     });
+    // Establish invariants.
+    for (const auto &Child : Children)
+      ReachedEnd |= Child->reachedEnd();
+    sync();
   }
 
   bool reachedEnd() const override { return ReachedEnd; }
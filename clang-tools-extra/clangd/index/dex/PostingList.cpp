@@ -102,8 +102,17 @@ private:
   void advanceToChunk(DocID ID) {
     if ((CurrentChunk != Chunks.end() - 1) &&
         ((CurrentChunk + 1)->Head <= ID)) {
+      // Intersections usually move a few chunks forward at a time, so gallop
+      // ahead to bound the binary search instead of searching the whole rest
+      // of the posting list.
+      auto Next = CurrentChunk + 1;
+      size_t Remaining = Chunks.end() - Next;
+      size_t Bound = 1;
+      while (Bound < Remaining && Next[Bound].Head < ID)
+        Bound *= 2;
       CurrentChunk =
-          std::partition_point(CurrentChunk + 1, Chunks.end(),
+          std::partition_point(Next + Bound / 2,
+                               Next + std::min(Bound + 1, Remaining),
                                [&](const Chunk &C) { return C.Head < ID; });
       --CurrentChunk;
       DecompressedChunk = CurrentChunk->decompress();
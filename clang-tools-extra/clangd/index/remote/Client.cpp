@@ -12,6 +12,7 @@
 #include "Feature.h"
 #include "Service.grpc.pb.h"
 #include "index/Index.h"
+#include "index/remote/LookupCache.h"
 #include "marshalling/Marshalling.h"
 #include "support/Logger.h"
 #include "support/Trace.h"
@@ -28,6 +29,13 @@ namespace clangd {
 namespace remote {
 namespace {
 
+// How long symbols returned by lookup() may be served from the client's
+// cache. This matches the interval at which the server checks for a new index,
+// which bounds staleness for servers that do not report their index version.
+constexpr std::chrono::seconds LookupCacheLifetime(30);
+// The maximum number of symbols kept in the client's lookup cache.
+constexpr size_t LookupCacheMaxSymbols = 10000;
+
 llvm::StringRef toString(const grpc_connectivity_state &State) {
   switch (State) {
   case GRPC_CHANNEL_IDLE:
@@ -62,7 +70,8 @@ class IndexClient : public clangd::SymbolIndex {
             typename CallbackT>
   bool streamRPC(ClangdRequestT Request,
                  StreamingCall<RequestT, ReplyT> RPCCall,
-                 CallbackT Callback) const {
+                 CallbackT Callback,
+                 llvm::Optional<uint64_t> *IndexVersion = nullptr) const {
     updateConnectionStatus();
     // We initialize to true because stream might be broken before we see the
     // final message. In such a case there are actually more results on the
@@ -88,6 +97,13 @@ class IndexClient : public clangd::SymbolIndex {
     while (Reader->Read(&Reply)) {
       if (!Reply.has_stream_result()) {
         HasMore = Reply.final_result().has_more();
+        if (Reply.final_result().has_index_version()) {
+          uint64_t Version = Reply.final_result().index_version();
+          if (IndexVersion)
+            *IndexVersion = Version;
+          // Any response may reveal that the server loaded a new index.
+          RecentLookups.updateIndexVersion(Version);
+        }
         continue;
       }
       auto Response = ProtobufMarshaller->fromProtobuf(Reply.stream_result());
@@ -123,14 +139,33 @@ public:
         ConnectionStatus(Channel->GetState(/*try_to_connect=*/true)),
         ProtobufMarshaller(new Marshaller(/*RemoteIndexRoot=*/"",
                                           /*LocalIndexRoot=*/ProjectRoot)),
-        DeadlineWaitingTime(DeadlineTime) {
+        DeadlineWaitingTime(DeadlineTime),
+        RecentLookups(LookupCacheMaxSymbols, LookupCacheLifetime) {
     assert(!ProjectRoot.empty());
   }
 
   void lookup(const clangd::LookupRequest &Request,
               llvm::function_ref<void(const clangd::Symbol &)> Callback)
       const override {
-    streamRPC(Request, &remote::v1::SymbolIndex::Stub::Lookup, Callback);
+    // Hover, signature help and code completion look up the same symbols over
+    // and over. Serve recently seen ones locally and only ask the server for
+    // the rest. Received symbols are only cached once the final message has
+    // told which index version served them.
+    clangd::LookupRequest Missing = Request;
+    for (const Symbol &S : RecentLookups.take(Missing))
+      Callback(S);
+    if (Missing.IDs.empty())
+      return;
+    SymbolSlab::Builder Received;
+    llvm::Optional<uint64_t> IndexVersion;
+    streamRPC(
+        Missing, &remote::v1::SymbolIndex::Stub::Lookup,
+        [&](const clangd::Symbol &S) {
+          Received.insert(S);
+          Callback(S);
+        },
+        &IndexVersion);
+    RecentLookups.insert(std::move(Received).build(), IndexVersion);
   }
 
   bool fuzzyFind(const clangd::FuzzyFindRequest &Request,
@@ -178,6 +213,8 @@ private:
   std::unique_ptr<Marshaller> ProtobufMarshaller;
   // Each request will be terminated if it takes too long.
   std::chrono::milliseconds DeadlineWaitingTime;
+  // Symbols received from recent lookup() calls.
+  mutable LookupCache RecentLookups;
 };
 
 } // namespace
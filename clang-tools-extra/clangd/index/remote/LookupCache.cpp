@@ -0,0 +1,88 @@
+//===--- LookupCache.cpp - Client-side cache of remote lookups ---*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "index/remote/LookupCache.h"
+
+namespace clang {
+namespace clangd {
+namespace remote {
+
+LookupCache::LookupCache(size_t MaxSymbols, Clock::duration Lifetime,
+                         std::function<Clock::time_point()> Now)
+    : MaxSymbols(MaxSymbols), Lifetime(Lifetime), Now(std::move(Now)) {
+  reset();
+}
+
+SymbolSlab LookupCache::take(clangd::LookupRequest &Req) {
+  SymbolSlab::Builder Hits;
+  llvm::DenseSet<SymbolID> Missing;
+  std::lock_guard<std::mutex> Lock(Mu);
+  expire();
+  for (const SymbolID &ID : Req.IDs) {
+    if (const Symbol *S = Symbols->find(ID))
+      Hits.insert(*S);
+    else
+      Missing.insert(ID);
+  }
+  Req.IDs = std::move(Missing);
+  return std::move(Hits).build();
+}
+
+void LookupCache::insert(const SymbolSlab &NewSymbols,
+                         llvm::Optional<uint64_t> NewIndexVersion) {
+  std::lock_guard<std::mutex> Lock(Mu);
+  expire();
+  // Once the server has reported an index version, symbols without one (e.g.
+  // from a stream that broke before its final message) are not trusted.
+  if (NewIndexVersion ? !acceptIndexVersion(*NewIndexVersion)
+                      : IndexVersion.hasValue())
+    return;
+  if (NumSymbols + NewSymbols.size() > MaxSymbols)
+    reset();
+  for (const Symbol &S : NewSymbols) {
+    if (NumSymbols == MaxSymbols)
+      break;
+    if (!Symbols->find(S.ID))
+      ++NumSymbols;
+    Symbols->insert(S);
+  }
+}
+
+void LookupCache::updateIndexVersion(uint64_t NewIndexVersion) {
+  std::lock_guard<std::mutex> Lock(Mu);
+  acceptIndexVersion(NewIndexVersion);
+}
+
+void LookupCache::expire() {
+  if (Now() - Created > Lifetime) {
+    reset();
+    // An expired cache no longer knows which version it follows, so that a
+    // server restarted with an older index is picked up again.
+    IndexVersion.reset();
+  }
+}
+
+void LookupCache::reset() {
+  Symbols = std::make_unique<SymbolSlab::Builder>();
+  NumSymbols = 0;
+  Created = Now();
+}
+
+bool LookupCache::acceptIndexVersion(uint64_t NewIndexVersion) {
+  if (IndexVersion && NewIndexVersion < *IndexVersion)
+    return false;
+  if (!IndexVersion || NewIndexVersion > *IndexVersion) {
+    reset();
+    IndexVersion = NewIndexVersion;
+  }
+  return true;
+}
+
+} // namespace remote
+} // namespace clangd
+} // namespace clang
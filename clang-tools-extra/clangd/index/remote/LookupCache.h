@@ -0,0 +1,80 @@
+//===--- LookupCache.h - Client-side cache of remote lookups -----*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANGD_INDEX_REMOTE_LOOKUPCACHE_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANGD_INDEX_REMOTE_LOOKUPCACHE_H
+
+#include "index/Index.h"
+#include "index/Symbol.h"
+#include "llvm/ADT/Optional.h"
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace clang {
+namespace clangd {
+namespace remote {
+
+/// Symbols returned by recent lookups on a remote index, so that repeated
+/// lookups of the same IDs (hover, signature help, completion item
+/// resolution) do not each need a round trip.
+///
+/// Every cached symbol was served by the same version of the server's index.
+/// A response from a newer version drops the whole cache, and a response from
+/// an older one (e.g. a request that raced with an index reload) is not
+/// recorded. Entries also expire after a fixed lifetime, which bounds
+/// staleness for servers that do not report an index version, and the cache
+/// is dropped rather than grown beyond a fixed number of symbols.
+///
+/// This class is thread-safe.
+class LookupCache {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  LookupCache(size_t MaxSymbols, Clock::duration Lifetime,
+              std::function<Clock::time_point()> Now = Clock::now);
+
+  /// Removes the IDs of \p Req that are in the cache, and returns their
+  /// symbols.
+  SymbolSlab take(clangd::LookupRequest &Req);
+
+  /// Records symbols returned by the server. \p IndexVersion is the version
+  /// of the index that served them, if the server reported it. Symbols from
+  /// an older index, or without a version once the server has reported one,
+  /// are not recorded.
+  void insert(const SymbolSlab &Symbols, llvm::Optional<uint64_t> IndexVersion);
+
+  /// Drops the cache if \p IndexVersion is newer than the cached symbols.
+  void updateIndexVersion(uint64_t IndexVersion);
+
+private:
+  // Drops the cache if it has expired. Must be called with Mu held.
+  void expire();
+  // Drops all cached symbols. Must be called with Mu held.
+  void reset();
+  // Returns false if symbols from IndexVersion must not be cached. Must be
+  // called with Mu held.
+  bool acceptIndexVersion(uint64_t IndexVersion);
+
+  const size_t MaxSymbols;
+  const Clock::duration Lifetime;
+  const std::function<Clock::time_point()> Now;
+
+  std::mutex Mu;
+  std::unique_ptr<SymbolSlab::Builder> Symbols;
+  size_t NumSymbols = 0;
+  Clock::time_point Created;
+  llvm::Optional<uint64_t> IndexVersion;
+};
+
+} // namespace remote
+} // namespace clangd
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANGD_INDEX_REMOTE_LOOKUPCACHE_H
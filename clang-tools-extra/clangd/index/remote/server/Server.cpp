@@ -33,6 +33,8 @@
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/VirtualFileSystem.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <grpc++/grpc++.h>
 #include <grpc++/health_check_service_interface.h>
@@ -115,8 +117,9 @@ static Key<grpc::ServerContext *> CurrentRequest;
 
 class RemoteIndexServer final : public v1::SymbolIndex::Service {
 public:
-  RemoteIndexServer(clangd::SymbolIndex &Index, llvm::StringRef IndexRoot)
-      : Index(Index) {
+  RemoteIndexServer(clangd::SymbolIndex &Index, llvm::StringRef IndexRoot,
+                    const std::atomic<uint64_t> &IndexVersion)
+      : Index(Index), IndexVersion(IndexVersion) {
     llvm::SmallString<256> NativePath = IndexRoot;
     llvm::sys::path::native(NativePath);
     ProtobufMarshaller = std::unique_ptr<Marshaller>(new Marshaller(
@@ -164,6 +167,8 @@ private:
       log("[public] Limiting result size for Lookup request.");
     LookupReply LastMessage;
     LastMessage.mutable_final_result()->set_has_more(HasMore);
+    LastMessage.mutable_final_result()->set_index_version(
+        IndexVersion.load());
     logResponse(LastMessage);
     Reply->Write(LastMessage);
     SPAN_ATTACH(Tracer, "Sent", Sent);
@@ -208,6 +213,8 @@ private:
     });
     FuzzyFindReply LastMessage;
     LastMessage.mutable_final_result()->set_has_more(HasMore);
+    LastMessage.mutable_final_result()->set_index_version(
+        IndexVersion.load());
     logResponse(LastMessage);
     Reply->Write(LastMessage);
     SPAN_ATTACH(Tracer, "Sent", Sent);
@@ -250,6 +257,8 @@ private:
     });
     RefsReply LastMessage;
     LastMessage.mutable_final_result()->set_has_more(HasMore);
+    LastMessage.mutable_final_result()->set_index_version(
+        IndexVersion.load());
     logResponse(LastMessage);
     Reply->Write(LastMessage);
     SPAN_ATTACH(Tracer, "Sent", Sent);
@@ -296,6 +305,8 @@ private:
         });
     RelationsReply LastMessage;
     LastMessage.mutable_final_result()->set_has_more(true);
+    LastMessage.mutable_final_result()->set_index_version(
+        IndexVersion.load());
     logResponse(LastMessage);
     Reply->Write(LastMessage);
     SPAN_ATTACH(Tracer, "Sent", Sent);
@@ -330,6 +341,7 @@ private:
 
   std::unique_ptr<Marshaller> ProtobufMarshaller;
   clangd::SymbolIndex &Index;
+  const std::atomic<uint64_t> &IndexVersion;
 };
 
 class Monitor final : public v1::Monitor::Service {
@@ -372,12 +384,21 @@ void maybeTrimMemory() {
 #endif
 }
 
+// The version reported to clients for an index file last modified at
+// \p ModificationTime. Restarting the server on the same file keeps the
+// version, so client caches stay valid.
+uint64_t indexVersion(llvm::sys::TimePoint<> ModificationTime) {
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             ModificationTime.time_since_epoch())
+      .count();
+}
+
 // Detect changes in \p IndexPath file and load new versions of the index
 // whenever they become available.
 void hotReload(clangd::SwapIndex &Index, llvm::StringRef IndexPath,
                llvm::vfs::Status &LastStatus,
                llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> &FS,
-               Monitor &Monitor) {
+               Monitor &Monitor, std::atomic<uint64_t> &IndexVersion) {
   // glibc malloc doesn't shrink an arena if there are items living at the end,
   // which might happen since we destroy the old index after building new one.
   // Trim more aggresively to keep memory usage of the server low.
@@ -401,14 +422,20 @@ void hotReload(clangd::SwapIndex &Index, llvm::StringRef IndexPath,
     return;
   }
   Index.reset(std::move(NewIndex));
+  // Bump the version only after the new index is in place, so that no client
+  // sees the new version together with results from the old index.
+  IndexVersion.store(
+      std::max(IndexVersion.load() + 1,
+               indexVersion(Status->getLastModificationTime())));
   Monitor.updateIndex(Status->getLastModificationTime());
   log("New index version loaded. Last modification time: {0}, size: {1} bytes.",
       Status->getLastModificationTime(), Status->getSize());
 }
 
 void runServerAndWait(clangd::SymbolIndex &Index, llvm::StringRef ServerAddress,
-                      llvm::StringRef IndexPath, Monitor &Monitor) {
-  RemoteIndexServer Service(Index, IndexRoot);
+                      llvm::StringRef IndexPath, Monitor &Monitor,
+                      const std::atomic<uint64_t> &IndexVersion) {
+  RemoteIndexServer Service(Index, IndexRoot, IndexVersion);
 
   grpc::EnableDefaultHealthCheckService(true);
 #if ENABLE_GRPC_REFLECTION
@@ -541,17 +568,21 @@ int main(int argc, char *argv[]) {
   clang::clangd::SwapIndex Index(std::move(SymIndex));
 
   Monitor Monitor(Status->getLastModificationTime());
+  std::atomic<uint64_t> IndexVersion(
+      indexVersion(Status->getLastModificationTime()));
 
-  std::thread HotReloadThread([&Index, &Status, &FS, &Monitor]() {
+  std::thread HotReloadThread([&Index, &Status, &FS, &Monitor,
+                               &IndexVersion]() {
     llvm::vfs::Status LastStatus = *Status;
     static constexpr auto RefreshFrequency = std::chrono::seconds(30);
     while (!clang::clangd::shutdownRequested()) {
-      hotReload(Index, llvm::StringRef(IndexPath), LastStatus, FS, Monitor);
+      hotReload(Index, llvm::StringRef(IndexPath), LastStatus, FS, Monitor,
+                IndexVersion);
       std::this_thread::sleep_for(RefreshFrequency);
     }
   });
 
-  runServerAndWait(Index, ServerAddress, IndexPath, Monitor);
+  runServerAndWait(Index, ServerAddress, IndexPath, Monitor, IndexVersion);
 
   HotReloadThread.join();
 }
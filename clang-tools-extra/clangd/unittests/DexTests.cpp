@@ -68,6 +68,28 @@ TEST(DexIterators, DocumentIterator) {
   EXPECT_TRUE(DocIterator->reachedEnd());
 }
 
+TEST(DexIterators, DocumentIteratorAcrossChunks) {
+  // Large gaps between documents make every chunk hold only a few of them.
+  std::vector<DocID> Docs;
+  for (DocID I = 0; I < 1000; ++I)
+    Docs.push_back(I * 100000);
+  const PostingList L(Docs);
+  auto DocIterator = L.iterator();
+
+  // Short and long jumps must land on the same documents as a linear scan.
+  for (DocID Target : {1U, 200000U, 200001U, 300000U, 7654321U, 7700000U,
+                       50000001U, 99900000U}) {
+    DocIterator->advanceTo(Target);
+    ASSERT_FALSE(DocIterator->reachedEnd());
+    auto Expected =
+        llvm::partition_point(Docs, [&](DocID D) { return D < Target; });
+    EXPECT_EQ(DocIterator->peek(), *Expected);
+  }
+
+  DocIterator->advanceTo(99900001);
+  EXPECT_TRUE(DocIterator->reachedEnd());
+}
+
 TEST(DexIterators, AndTwoLists) {
   Corpus C{10000};
   const PostingList L0({0, 5, 7, 10, 42, 320, 9000});
@@ -0,0 +1,96 @@
+//===--- LookupCacheTests.cpp ------------------------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "TestIndex.h"
+#include "index/Index.h"
+#include "index/Symbol.h"
+#include "index/remote/LookupCache.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace clang {
+namespace clangd {
+namespace remote {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+class LookupCacheTest : public ::testing::Test {
+protected:
+  LookupCache::Clock::time_point Time;
+  LookupCache Cache{/*MaxSymbols=*/3, std::chrono::seconds(30),
+                    [this] { return Time; }};
+
+  // Looks up Names in the cache, returning the names that were missing.
+  std::vector<std::string> lookup(std::vector<std::string> Names,
+                                  std::vector<std::string> *Hits = nullptr) {
+    LookupRequest Req;
+    for (const auto &Name : Names)
+      Req.IDs.insert(SymbolID(Name));
+    SymbolSlab Found = Cache.take(Req);
+    if (Hits)
+      for (const Symbol &S : Found)
+        Hits->push_back(std::string(S.Name));
+    std::vector<std::string> Missing;
+    for (const auto &Name : Names)
+      if (Req.IDs.count(SymbolID(Name)))
+        Missing.push_back(Name);
+    return Missing;
+  }
+};
+
+TEST_F(LookupCacheTest, HitsAndMisses) {
+  EXPECT_THAT(lookup({"X", "Y"}), ElementsAre("X", "Y"));
+  Cache.insert(generateSymbols({"X"}), 1);
+  std::vector<std::string> Hits;
+  EXPECT_THAT(lookup({"X", "Y"}, &Hits), ElementsAre("Y"));
+  EXPECT_THAT(Hits, ElementsAre("X"));
+}
+
+TEST_F(LookupCacheTest, Expiry) {
+  Cache.insert(generateSymbols({"X"}), llvm::None);
+  Time += std::chrono::seconds(30);
+  EXPECT_THAT(lookup({"X"}), IsEmpty());
+  Time += std::chrono::seconds(1);
+  EXPECT_THAT(lookup({"X"}), ElementsAre("X"));
+}
+
+TEST_F(LookupCacheTest, IndexVersion) {
+  Cache.insert(generateSymbols({"X"}), 2);
+  // Results from an older index are not recorded.
+  Cache.insert(generateSymbols({"Y"}), 1);
+  EXPECT_THAT(lookup({"X", "Y"}), ElementsAre("Y"));
+  // Nor are results without a version once the server reported one.
+  Cache.insert(generateSymbols({"Y"}), llvm::None);
+  EXPECT_THAT(lookup({"X", "Y"}), ElementsAre("Y"));
+  // A newer index drops everything cached from the old one.
+  Cache.updateIndexVersion(3);
+  EXPECT_THAT(lookup({"X"}), ElementsAre("X"));
+  Cache.insert(generateSymbols({"Y"}), 3);
+  Cache.insert(generateSymbols({"Z"}), 4);
+  EXPECT_THAT(lookup({"Y", "Z"}), ElementsAre("Y"));
+}
+
+TEST_F(LookupCacheTest, MaxSymbols) {
+  Cache.insert(generateSymbols({"A", "B"}), 1);
+  EXPECT_THAT(lookup({"A", "B"}), IsEmpty());
+  // Exceeding the cap drops the cache before inserting.
+  Cache.insert(generateSymbols({"C", "D"}), 1);
+  EXPECT_THAT(lookup({"A", "B", "C", "D"}), ElementsAre("A", "B"));
+  // A single response larger than the cap is truncated.
+  Cache.insert(generateSymbols({"E", "F", "G", "H"}), 1);
+  std::vector<std::string> Hits;
+  EXPECT_EQ(lookup({"E", "F", "G", "H"}, &Hits).size(), 1u);
+  EXPECT_EQ(Hits.size(), 3u);
+}
+
+} // namespace
+} // namespace remote
+} // namespace clangd
+} // namespace clang
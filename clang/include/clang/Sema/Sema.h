@@ -1367,6 +1367,25 @@ public:
   /// for C++ records.
   llvm::FoldingSet<SpecialMemberOverloadResultEntry> SpecialMemberCache;
 
+  /// The type produced by substituting a list of non-dependent template
+  /// arguments into an alias template.
+  class AliasTemplateSubstEntry : public llvm::FastFoldingSetNode {
+  public:
+    AliasTemplateSubstEntry(const llvm::FoldingSetNodeID &ID, QualType Result)
+        : FastFoldingSetNode(ID), Result(Result) {}
+
+    QualType Result;
+  };
+
+  /// A cache of alias template substitutions, used to avoid substituting into
+  /// the same alias template specialization more than once. Only aliases whose
+  /// pattern does not depend on name lookup are recorded.
+  llvm::FoldingSet<AliasTemplateSubstEntry> AliasTemplateSubstCache;
+
+  /// The number of alias template specializations served from
+  /// AliasTemplateSubstCache.
+  unsigned NumAliasTemplateSubstCacheHits = 0;
+
   /// A cache of the flags available in enumerations with the flag_bits
   /// attribute.
   mutable llvm::DenseMap<const EnumDecl*, llvm::APInt> FlagBitsCache;
@@ -16,6 +16,7 @@
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/VirtualFileSystem.h"
+#include <atomic>
 #include <mutex>
 
 namespace clang {
@@ -121,6 +122,16 @@ public:
   /// thread safe call.
   SharedFileSystemEntry &get(StringRef Key, bool Minimized);
 
+  /// Records whether a lookup was served from an already populated entry or
+  /// had to go to the underlying file system. This is a thread safe call.
+  void noteLookup(bool IsHit) { (IsHit ? NumHits : NumMisses)++; }
+
+  /// \returns The number of lookups served from a populated entry.
+  unsigned getNumHits() const { return NumHits; }
+
+  /// \returns The number of lookups that queried the underlying file system.
+  unsigned getNumMisses() const { return NumMisses; }
+
 private:
   class SingleCache {
   public:
@@ -139,6 +150,9 @@ private:
 
   SingleCache CacheMinimized;
   SingleCache CacheOriginal;
+
+  std::atomic<unsigned> NumHits{0};
+  std::atomic<unsigned> NumMisses{0};
 };
 
 /// This class is a local cache, that caches the 'stat' and 'open' calls to the
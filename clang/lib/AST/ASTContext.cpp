@@ -1055,7 +1055,7 @@ void ASTContext::PrintStats() const {
   }
 
   unsigned Idx = 0;
-  unsigned TotalBytes = 0;
+  size_t TotalBytes = 0;
 #define TYPE(Name, Parent)                                              \
   if (counts[Idx])                                                      \
     llvm::errs() << "    " << counts[Idx] << " " << #Name               \
@@ -1096,6 +1096,8 @@ void ASTContext::PrintStats() const {
     ExternalSource->PrintStats();
   }
 
+  llvm::errs() << "\n" << getSideTableAllocatedMemory()
+               << " bytes allocated for side tables\n";
   BumpAlloc.PrintStats();
 }
 
@@ -24,12 +24,13 @@
 #include "llvm/ADT/Triple.h"
 #include "llvm/Option/ArgList.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/LineIterator.h"
 #include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/YAMLParser.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
-#include <fstream>
 #include <sstream>
 #include <tuple>
 
@@ -151,16 +152,17 @@ std::error_code IndexError::convertToErrorCode() const {
 
 llvm::Expected<llvm::StringMap<std::string>>
 parseCrossTUIndex(StringRef IndexPath) {
-  std::ifstream ExternalMapFile{std::string(IndexPath)};
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ExternalMapFile =
+      llvm::MemoryBuffer::getFile(IndexPath, /*IsText=*/true);
   if (!ExternalMapFile)
     return llvm::make_error<IndexError>(index_error_code::missing_index_file,
                                         IndexPath.str());
 
   llvm::StringMap<std::string> Result;
-  std::string Line;
   unsigned LineNo = 1;
-  while (std::getline(ExternalMapFile, Line)) {
-    StringRef LineRef{Line};
+  for (llvm::line_iterator It(**ExternalMapFile, /*SkipBlanks=*/false);
+       !It.is_at_eof(); ++It) {
+    StringRef LineRef = *It;
     const size_t Delimiter = LineRef.find(' ');
     if (Delimiter > 0 && Delimiter != std::string::npos) {
       StringRef LookupName = LineRef.substr(0, Delimiter);
@@ -475,7 +477,7 @@ llvm::Error CrossTranslationUnitContext::ASTUnitStorage::ensureCTUIndexLoaded(
 
   if (auto IndexMapping = parseCrossTUIndex(IndexFile)) {
     // Initialize member map.
-    NameFileMap = *IndexMapping;
+    NameFileMap = std::move(*IndexMapping);
     return llvm::Error::success();
   } else {
     // Error while parsing CrossTU index file.
@@ -2364,6 +2364,13 @@ bool Lexer::SkipWhitespace(Token &Result, const char *CurPtr,
   return false;
 }
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 /// We have just read the // characters from input.  Skip until we find the
 /// newline character that terminates the comment.  Then update BufferPtr and
 /// return.
@@ -2390,6 +2397,26 @@ bool Lexer::SkipLineComment(Token &Result, const char *CurPtr,
   // character that ends the line comment.
   char C;
   while (true) {
+#ifdef __SSE2__
+    // Skip over 16 characters at a time as long as none of them is a newline
+    // or a potential EOF. Line comments are often long, e.g. license headers
+    // and documentation comments.
+    __m128i Newlines = _mm_set1_epi8('\n');
+    __m128i CarriageReturns = _mm_set1_epi8('\r');
+    __m128i Zeros = _mm_setzero_si128();
+    while (CurPtr + 16 <= BufferEnd) {
+      __m128i Chars = _mm_loadu_si128((const __m128i *)CurPtr);
+      __m128i Stops = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(Chars, Newlines),
+                       _mm_cmpeq_epi8(Chars, CarriageReturns)),
+          _mm_cmpeq_epi8(Chars, Zeros));
+      if (int Mask = _mm_movemask_epi8(Stops)) {
+        CurPtr += llvm::countTrailingZeros<unsigned>(Mask);
+        break;
+      }
+      CurPtr += 16;
+    }
+#endif
     C = *CurPtr;
     // Skip over characters in the fast loop.
     while (C != 0 &&                // Potentially EOF.
@@ -2611,13 +2638,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
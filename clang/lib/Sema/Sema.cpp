@@ -540,6 +540,8 @@ void Sema::addExternalSource(ExternalSemaSource *E) {
 void Sema::PrintStats() const {
   llvm::errs() << "\n*** Semantic Analysis Stats:\n";
   llvm::errs() << NumSFINAEErrors << " SFINAE diagnostics trapped.\n";
+  llvm::errs() << NumAliasTemplateSubstCacheHits
+               << " alias template substitutions reused.\n";
 
   BumpAlloc.PrintStats();
   AnalysisWarnings.PrintStats();
@@ -3510,6 +3510,142 @@ checkBuiltinTemplateIdType(Sema &SemaRef, BuiltinTemplateDecl *BTD,
   llvm_unreachable("unexpected BuiltinTemplateDecl!");
 }
 
+/// Determine whether the result of substituting this converted template
+/// argument into an alias template can be reused for a later reference to the
+/// same specialization.
+static bool isMemoizableAliasTemplateArgument(const TemplateArgument &Arg) {
+  switch (Arg.getKind()) {
+  case TemplateArgument::Type:
+  case TemplateArgument::Declaration:
+  case TemplateArgument::NullPtr:
+  case TemplateArgument::Integral:
+  case TemplateArgument::Template:
+    return !Arg.isInstantiationDependent() &&
+           !Arg.containsUnexpandedParameterPack();
+
+  case TemplateArgument::Pack:
+    return llvm::all_of(Arg.pack_elements(),
+                        isMemoizableAliasTemplateArgument);
+
+  case TemplateArgument::Null:
+  case TemplateArgument::TemplateExpansion:
+  case TemplateArgument::Expression:
+    return false;
+  }
+  llvm_unreachable("unknown template argument kind");
+}
+
+static bool isLookupIndependentAliasPattern(QualType T);
+
+static bool
+isLookupIndependentAliasPatternArgument(const TemplateArgument &Arg) {
+  switch (Arg.getKind()) {
+  case TemplateArgument::Null:
+  case TemplateArgument::Declaration:
+  case TemplateArgument::NullPtr:
+  case TemplateArgument::Integral:
+  case TemplateArgument::Template:
+  case TemplateArgument::TemplateExpansion:
+    return true;
+
+  case TemplateArgument::Type:
+    return isLookupIndependentAliasPattern(Arg.getAsType());
+
+  case TemplateArgument::Expression: {
+    // Only a reference to a non-type template parameter is known to be
+    // replaced by its argument without any lookup.
+    const Expr *E = Arg.getAsExpr()->IgnoreImpCasts();
+    if (const auto *Expansion = dyn_cast<PackExpansionExpr>(E))
+      E = Expansion->getPattern()->IgnoreImpCasts();
+    const auto *DRE = dyn_cast<DeclRefExpr>(E);
+    return DRE && isa<NonTypeTemplateParmDecl>(DRE->getDecl());
+  }
+
+  case TemplateArgument::Pack:
+    return llvm::all_of(Arg.pack_elements(),
+                        isLookupIndependentAliasPatternArgument);
+  }
+  llvm_unreachable("unknown template argument kind");
+}
+
+/// Determine whether substituting into the given alias template pattern
+/// depends only on the template arguments. Dependent names, expressions and
+/// template template parameters are rejected, since the result of
+/// substituting into them depends on name lookup (including ADL) and overload
+/// resolution at the point of use and can change as more declarations become
+/// visible.
+static bool isLookupIndependentAliasPattern(QualType T) {
+  // A non-dependent type is left unchanged by substitution.
+  if (!T->isInstantiationDependentType() && !T->isVariablyModifiedType())
+    return true;
+
+  const Type *Ty = T.getTypePtr();
+  switch (Ty->getTypeClass()) {
+  case Type::TemplateTypeParm:
+    return true;
+  case Type::SubstTemplateTypeParm:
+    return isLookupIndependentAliasPattern(
+        cast<SubstTemplateTypeParmType>(Ty)->getReplacementType());
+  case Type::Paren:
+    return isLookupIndependentAliasPattern(cast<ParenType>(Ty)->getInnerType());
+  case Type::Pointer:
+  case Type::BlockPointer:
+    return isLookupIndependentAliasPattern(Ty->getPointeeType());
+  case Type::LValueReference:
+  case Type::RValueReference:
+    return isLookupIndependentAliasPattern(
+        cast<ReferenceType>(Ty)->getPointeeTypeAsWritten());
+  case Type::MemberPointer: {
+    const auto *MPT = cast<MemberPointerType>(Ty);
+    return isLookupIndependentAliasPattern(MPT->getPointeeType()) &&
+           isLookupIndependentAliasPattern(QualType(MPT->getClass(), 0));
+  }
+  case Type::ConstantArray:
+  case Type::IncompleteArray:
+    return isLookupIndependentAliasPattern(
+        cast<ArrayType>(Ty)->getElementType());
+  case Type::PackExpansion:
+    return isLookupIndependentAliasPattern(
+        cast<PackExpansionType>(Ty)->getPattern());
+  case Type::Elaborated: {
+    const auto *ET = cast<ElaboratedType>(Ty);
+    if (NestedNameSpecifier *NNS = ET->getQualifier())
+      if (NNS->isInstantiationDependent())
+        return false;
+    return isLookupIndependentAliasPattern(ET->getNamedType());
+  }
+  case Type::FunctionProto: {
+    const auto *FPT = cast<FunctionProtoType>(Ty);
+    switch (FPT->getExceptionSpecType()) {
+    case EST_None:
+    case EST_DynamicNone:
+    case EST_BasicNoexcept:
+      break;
+    default:
+      return false;
+    }
+    return isLookupIndependentAliasPattern(FPT->getReturnType()) &&
+           llvm::all_of(FPT->param_types(), isLookupIndependentAliasPattern);
+  }
+  case Type::TemplateSpecialization: {
+    const auto *TST = cast<TemplateSpecializationType>(Ty);
+    TemplateName Name = TST->getTemplateName();
+    TemplateDecl *TD = Name.getAsTemplateDecl();
+    if (!TD || Name.isDependent())
+      return false;
+    // A nested alias template is substituted along with this one.
+    if (const auto *Alias = dyn_cast<TypeAliasTemplateDecl>(TD))
+      if (!isLookupIndependentAliasPattern(
+              Alias->getTemplatedDecl()->getUnderlyingType()))
+        return false;
+    return llvm::all_of(TST->template_arguments(),
+                        isLookupIndependentAliasPatternArgument);
+  }
+  default:
+    return false;
+  }
+}
+
 /// Determine whether this alias template is "enable_if_t".
 /// libc++ >=14 uses "__enable_if_t" in C++11 mode.
 static bool isEnableIfAliasTemplate(TypeAliasTemplateDecl *AliasTemplate) {
@@ -3700,6 +3836,30 @@ QualType Sema::CheckTemplateIdType(TemplateName Name,
     if (Pattern->isInvalidDecl())
       return QualType();
 
+    // Substituting the same non-dependent arguments into an alias template
+    // whose pattern involves no name lookup produces the same type every
+    // time, so reuse the result of an earlier substitution that completed
+    // without any diagnostics. Entries are only recorded once the pattern has
+    // been checked below, so a hit needs no further checks.
+    llvm::FoldingSetNodeID MemoID;
+    void *MemoInsertPos = nullptr;
+    bool CanMemoize =
+        llvm::all_of(Converted, isMemoizableAliasTemplateArgument);
+    if (CanMemoize) {
+      MemoID.AddPointer(AliasTemplate);
+      for (const TemplateArgument &Arg : Converted)
+        Arg.Profile(MemoID, Context);
+      if (AliasTemplateSubstEntry *Entry =
+              AliasTemplateSubstCache.FindNodeOrInsertPos(MemoID,
+                                                          MemoInsertPos)) {
+        ++NumAliasTemplateSubstCacheHits;
+        return Context.getTemplateSpecializationType(Name, TemplateArgs,
+                                                     Entry->Result);
+      }
+    }
+    unsigned PrevErrors = Diags.getNumErrors();
+    unsigned PrevWarnings = Diags.getNumWarnings();
+
     TemplateArgumentList StackTemplateArgs(TemplateArgumentList::OnStack,
                                            Converted);
 
@@ -3752,6 +3912,20 @@ QualType Sema::CheckTemplateIdType(TemplateName Name,
 
       return QualType();
     }
+
+    // Only remember substitutions performed outside of a SFINAE context, where
+    // any diagnostic would have been counted above rather than trapped. Look
+    // the entry up again: the substitution may have inserted other entries and
+    // invalidated MemoInsertPos.
+    if (CanMemoize && !isSFINAEContext() &&
+        Diags.getNumErrors() == PrevErrors &&
+        Diags.getNumWarnings() == PrevWarnings &&
+        isLookupIndependentAliasPattern(Pattern->getUnderlyingType()) &&
+        !AliasTemplateSubstCache.FindNodeOrInsertPos(MemoID, MemoInsertPos)) {
+      auto *Entry = new (BumpAlloc.Allocate<AliasTemplateSubstEntry>())
+          AliasTemplateSubstEntry(MemoID, CanonType);
+      AliasTemplateSubstCache.InsertNode(Entry, MemoInsertPos);
+    }
   } else if (Name.isDependent() ||
              TemplateSpecializationType::anyDependentTemplateArguments(
                  TemplateArgs, Converted)) {
@@ -181,6 +181,7 @@ DependencyScanningWorkerFilesystem::getOrCreateFileSystemEntry(
     std::unique_lock<std::mutex> LockGuard(SharedCacheEntry.ValueLock);
     CachedFileSystemEntry &CacheEntry = SharedCacheEntry.Value;
 
+    SharedCache.noteLookup(CacheEntry.isValid());
     if (!CacheEntry.isValid()) {
       llvm::vfs::FileSystem &FS = getUnderlyingFS();
       auto MaybeStatus = FS.status(Filename);
@@ -0,0 +1,11 @@
+// RUN: %clangxx -S -ftime-trace -ftime-trace-granularity=0 -ftime-trace-memory -o %T/check-time-trace-memory %s
+// RUN: cat %T/check-time-trace-memory.json \
+// RUN:   | %python -c 'import json, sys; json.dump(json.loads(sys.stdin.read()), sys.stdout, sort_keys=True, indent=2)' \
+// RUN:   | FileCheck %s
+
+// CHECK:      "traceEvents": [
+// CHECK:      "args":
+// CHECK:      "malloc delta": {{-?[0-9]+}}
+// CHECK:      "name": "process_name"
+
+int main() { return 0; }
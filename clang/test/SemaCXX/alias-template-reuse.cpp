@@ -0,0 +1,55 @@
+// RUN: %clang_cc1 -verify -std=c++17 %s
+// RUN: %clang_cc1 -verify -std=c++20 %s
+
+// Referring to the same alias template specialization more than once must
+// behave the same as the first reference, whether or not the result of the
+// substitution is reused.
+
+template <typename T> struct Box { using type = T; };
+template <typename T> using Unbox = typename T::type;
+
+static_assert(__is_same(Unbox<Box<int>>, int));
+static_assert(__is_same(Unbox<Box<int>>, int));
+static_assert(__is_same(Unbox<Box<const int>>, const int));
+
+template <typename... Ts> using First = __type_pack_element<0, Ts...>;
+static_assert(__is_same(First<int, char>, int));
+static_assert(__is_same(First<int, char>, int));
+
+template <typename T, typename = Unbox<T>> constexpr bool hasType(int) {
+  return true;
+}
+template <typename T> constexpr bool hasType(...) { return false; }
+
+static_assert(hasType<Box<int>>(0));
+static_assert(!hasType<int>(0));
+static_assert(!hasType<int>(0));
+
+template <typename T> using Ptr = T *; // expected-error 2{{declared as a pointer to a reference}}
+Ptr<int &> p1; // expected-note {{in instantiation of template type alias 'Ptr' requested here}}
+Ptr<int &> p2; // expected-note {{in instantiation of template type alias 'Ptr' requested here}}
+
+// The result of substituting into a pattern that involves name lookup depends
+// on the declarations visible at the point of use, so it must not be reused.
+namespace N {
+struct A {};
+int f(...);
+} // namespace N
+template <class T> using R = decltype(f(T()));
+static_assert(__is_same(R<N::A>, int));
+namespace N {
+char f(A);
+} // namespace N
+static_assert(__is_same(R<N::A>, char));
+
+template <template <class> class TT, class T> using Apply = TT<T>;
+namespace N {
+struct B {};
+int g(...);
+} // namespace N
+template <class T> using S = decltype(g(T()));
+static_assert(__is_same(Apply<S, N::B>, int));
+namespace N {
+char g(B);
+} // namespace N
+static_assert(__is_same(Apply<S, N::B>, char));
@@ -566,6 +566,12 @@ int main(int argc, const char **argv) {
   }
   Pool.wait();
 
+  if (Verbose) {
+    DependencyScanningFilesystemSharedCache &Cache = Service.getSharedCache();
+    llvm::outs() << "File system cache: " << Cache.getNumHits() << " hits, "
+                 << Cache.getNumMisses() << " misses\n";
+  }
+
   if (Format == ScanningOutputFormat::Full)
     FD.printFullOutput(llvm::outs());
 
@@ -620,6 +620,19 @@ TEST_F(LexerTest, FindNextToken) {
                                                 "xyz", "=", "abcd", ";"));
 }
 
+TEST_F(LexerTest, LongLineComments) {
+  // Line comments longer than one vector chunk, ending at every position
+  // within a chunk, with and without escaped newlines.
+  for (unsigned Len = 0; Len != 40; ++Len) {
+    std::string Comment = "// " + std::string(Len, 'x');
+    CheckLex(Comment + "\nint a;", {tok::kw_int, tok::identifier, tok::semi});
+    CheckLex(Comment + "\r\nint a;",
+             {tok::kw_int, tok::identifier, tok::semi});
+    CheckLex(Comment + "\\\nint a;\nint", {tok::kw_int});
+    CheckLex(Comment, {});
+  }
+}
+
 TEST_F(LexerTest, CreatedFIDCountForPredefinedBuffer) {
   TrivialModuleLoader ModLoader;
   auto PP = CreatePP("", ModLoader);
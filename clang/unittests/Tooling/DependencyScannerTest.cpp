@@ -233,6 +233,29 @@ TEST(DependencyScanningFilesystem, IgnoredFilesHaveSeparateCache) {
   EXPECT_EQ(StatusFull3->getSize(), 13u);
 }
 
+TEST(DependencyScanningFilesystem, SharedCacheCountsHitsAndMisses) {
+  auto VFS = llvm::makeIntrusiveRefCnt<llvm::vfs::InMemoryFileSystem>();
+  VFS->addFile("/mod.h", 0, llvm::MemoryBuffer::getMemBuffer("// hi there!\n"));
+
+  DependencyScanningFilesystemSharedCache SharedCache;
+  auto Mappings = std::make_unique<ExcludedPreprocessorDirectiveSkipMapping>();
+  DependencyScanningWorkerFilesystem DepFS0(SharedCache, VFS, Mappings.get());
+  DependencyScanningWorkerFilesystem DepFS1(SharedCache, VFS, Mappings.get());
+
+  EXPECT_TRUE(DepFS0.status("/mod.h"));
+  EXPECT_EQ(SharedCache.getNumHits(), 0u);
+  EXPECT_EQ(SharedCache.getNumMisses(), 1u);
+
+  // Repeated queries from the same worker are served by its local cache.
+  EXPECT_TRUE(DepFS0.status("/mod.h"));
+  EXPECT_EQ(SharedCache.getNumHits(), 0u);
+  EXPECT_EQ(SharedCache.getNumMisses(), 1u);
+
+  EXPECT_TRUE(DepFS1.status("/mod.h"));
+  EXPECT_EQ(SharedCache.getNumHits(), 1u);
+  EXPECT_EQ(SharedCache.getNumMisses(), 1u);
+}
+
 } // end namespace dependencies
 } // end namespace tooling
 } // end namespace clang
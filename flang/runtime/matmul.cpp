@@ -52,6 +52,30 @@ private:
   Result sum_{};
 };
 
+// Contiguous numeric matrix*matrix multiplication
+//   matrix(rows,n) * matrix(n,cols) -> matrix(rows,cols)
+// The loops are ordered so that the innermost one walks unit strides through
+// X and the result with a loop-invariant element of Y, and no descriptor
+// subscript arithmetic is needed.  Each result element still accumulates its
+// products in increasing K order, as the general implementation does.
+template <typename RT, typename XT, typename YT>
+static inline void MatrixTimesMatrix(RT *product, SubscriptValue rows,
+    SubscriptValue cols, const XT *x, const YT *y, SubscriptValue n) {
+  for (SubscriptValue p{0}; p < rows * cols; ++p) {
+    product[p] = RT{};
+  }
+  for (SubscriptValue k{0}; k < n; ++k) {
+    const XT *xk{x + k * rows};
+    for (SubscriptValue j{0}; j < cols; ++j) {
+      RT yv{static_cast<RT>(y[k + j * n])};
+      RT *pj{product + j * rows};
+      for (SubscriptValue i{0}; i < rows; ++i) {
+        pj[i] += static_cast<RT>(xk[i]) * yv;
+      }
+    }
+  }
+}
+
 // Implements an instance of MATMUL for given argument types.
 template <bool IS_ALLOCATING, TypeCategory RCAT, int RKIND, typename XT,
     typename YT>
@@ -109,6 +133,18 @@ static inline void DoMatmul(
         // TODO: call BLAS-3 ZGEMM
       }
     }
+    // Use the contiguous kernel when it accumulates in the same type as the
+    // general implementation, so that results are unchanged.
+    if constexpr (RCAT != TypeCategory::Logical &&
+        std::is_same_v<typename Accumulator<RCAT, RKIND, XT, YT>::Result,
+            WriteResult>) {
+      if (x.IsContiguous() && y.IsContiguous() && result.IsContiguous()) {
+        MatrixTimesMatrix(result.template OffsetElement<WriteResult>(),
+            extent[0], extent[1], x.OffsetElement<XT>(), y.OffsetElement<YT>(),
+            n);
+        return;
+      }
+    }
     SubscriptValue x1{xAt[1]}, y0{yAt[0]}, y1{yAt[1]}, res1{resAt[1]};
     for (SubscriptValue i{0}; i < extent[0]; ++i) {
       for (SubscriptValue j{0}; j < extent[1]; ++j) {
@@ -73,6 +73,19 @@ TEST(Matmul, Basic) {
   EXPECT_EQ(*result.ZeroBasedIndexedElement<std::int64_t>(2), -30);
   result.Destroy();
 
+  auto xReal{MakeArray<TypeCategory::Real, 8>(
+      std::vector<int>{2, 3}, std::vector<double>{0, 1, 2, 3, 4, 5})};
+  auto yReal{MakeArray<TypeCategory::Real, 8>(
+      std::vector<int>{3, 2}, std::vector<double>{6, 7, 8, 9, 10, 11})};
+  RTNAME(Matmul)(result, *xReal, *yReal, __FILE__, __LINE__);
+  ASSERT_EQ(result.rank(), 2);
+  ASSERT_EQ(result.type(), (TypeCode{TypeCategory::Real, 8}));
+  EXPECT_EQ(*result.ZeroBasedIndexedElement<double>(0), 46);
+  EXPECT_EQ(*result.ZeroBasedIndexedElement<double>(1), 67);
+  EXPECT_EQ(*result.ZeroBasedIndexedElement<double>(2), 64);
+  EXPECT_EQ(*result.ZeroBasedIndexedElement<double>(3), 94);
+  result.Destroy();
+
   // X F F T  Y F T
   //   F T T    F T
   //            F F
@@ -11,6 +11,9 @@
 #define _LIBCPP___ALGORITHM_FIND_H
 
 #include <__config>
+#include <__algorithm/unwrap_iter.h>
+#include <cstring>
+#include <type_traits>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #pragma GCC system_header
@@ -19,14 +22,50 @@
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 template <class _InputIterator, class _Tp>
-_LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _InputIterator
-find(_InputIterator __first, _InputIterator __last, const _Tp& __value_) {
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _InputIterator
+__find_constexpr(_InputIterator __first, _InputIterator __last, const _Tp& __value_) {
   for (; __first != __last; ++__first)
     if (*__first == __value_)
       break;
   return __first;
 }
 
+template <class _InputIterator, class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _InputIterator
+__find(_InputIterator __first, _InputIterator __last, const _Tp& __value_) {
+  return _VSTD::__find_constexpr(__first, __last, __value_);
+}
+
+// Searching a contiguous range of byte-sized integers for a value of the same
+// type can be done with memchr.
+template <class _Tp, class _Up>
+inline _LIBCPP_INLINE_VISIBILITY
+typename enable_if
+<
+    is_same<typename remove_const<_Tp>::type, _Up>::value &&
+    is_integral<_Up>::value && sizeof(_Up) == 1,
+    _Tp*
+>::type
+__find(_Tp* __first, _Tp* __last, const _Up& __value_) {
+  if (__first == __last)
+    return __last;
+  if (const void* __p = _VSTD::memchr(__first, static_cast<unsigned char>(__value_),
+                                      static_cast<size_t>(__last - __first)))
+    return static_cast<_Tp*>(const_cast<void*>(__p));
+  return __last;
+}
+
+template <class _InputIterator, class _Tp>
+_LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _InputIterator
+find(_InputIterator __first, _InputIterator __last, const _Tp& __value_) {
+  if (__libcpp_is_constant_evaluated()) {
+    return _VSTD::__find_constexpr(__first, __last, __value_);
+  } else {
+    return _VSTD::__rewrap_iter(__first,
+        _VSTD::__find(_VSTD::__unwrap_iter(__first), _VSTD::__unwrap_iter(__last), __value_));
+  }
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___ALGORITHM_FIND_H
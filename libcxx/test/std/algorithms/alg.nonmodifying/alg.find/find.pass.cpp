@@ -39,6 +39,24 @@ int main(int, char**)
     r = std::find(cpp17_input_iterator<const int*>(ia), cpp17_input_iterator<const int*>(ia+s), 10);
     assert(r == cpp17_input_iterator<const int*>(ia+s));
 
+    // Byte-sized element types may take an optimized path.
+    {
+    char ca[] = {'a', 'b', 'c', 'b'};
+    const unsigned cs = sizeof(ca)/sizeof(ca[0]);
+    assert(std::find(ca, ca+cs, 'b') == ca+1);
+    assert(std::find(ca, ca+cs, 'z') == ca+cs);
+    assert(std::find(ca, ca, 'a') == ca);
+    const char* cca = ca;
+    assert(std::find(cca, cca+cs, 'c') == cca+2);
+    // A value that does not fit in the element type never matches.
+    assert(std::find(ca, ca+cs, 'a' + 256) == ca+cs);
+    unsigned char ua[] = {1, 255, 0};
+    assert(std::find(ua, ua+3, static_cast<unsigned char>(255)) == ua+1);
+    assert(std::find(ua, ua+3, static_cast<unsigned char>(0)) == ua+2);
+    signed char sa[] = {1, -1, 0};
+    assert(std::find(sa, sa+3, static_cast<signed char>(-1)) == sa+1);
+    }
+
 #if TEST_STD_VER > 17
     static_assert(test_constexpr());
 #endif
@@ -540,20 +540,6 @@ Error UsePrecompSource::mergeDebugT(TypeMerger *m) {
 // Parellel GHash type merging implementation.
 //===----------------------------------------------------------------------===//
 
-void TpiSource::loadGHashes() {
-  if (Optional<ArrayRef<uint8_t>> debugH = getDebugH(file)) {
-    ghashes = getHashesFromDebugH(*debugH);
-    ownedGHashes = false;
-  } else {
-    CVTypeArray types;
-    BinaryStreamReader reader(file->debugTypes, support::little);
-    cantFail(reader.readArray(types, reader.getLength()));
-    assignGHashesFromVector(GloballyHashedType::hashTypes(types));
-  }
-
-  fillIsItemIndexFromDebugT();
-}
-
 // Copies ghashes from a vector into an array. These are long lived, so it's
 // worth the time to copy these into an appropriately sized vector to reduce
 // memory usage.
@@ -578,6 +564,45 @@ static void forEachTypeChecked(ArrayRef<uint8_t> types,
       }));
 }
 
+void TpiSource::loadGHashes() {
+  if (Optional<ArrayRef<uint8_t>> debugH = getDebugH(file)) {
+    ghashes = getHashesFromDebugH(*debugH);
+    ownedGHashes = false;
+    fillIsItemIndexFromDebugT();
+    return;
+  }
+
+  // Without .debug$H, compute the hashes and the isItemIndex bits in a single
+  // walk over the type records instead of reading them twice.
+  std::vector<GloballyHashedType> hashVec;
+  bool unresolvedRecords = false;
+  forEachTypeChecked(file->debugTypes, [&](const CVType &ty) {
+    hashVec.push_back(GloballyHashedType::hashType(ty, hashVec, hashVec));
+    unresolvedRecords |= hashVec.back().empty();
+    isItemIndex.push_back(isIdRecord(ty.kind()));
+  });
+
+  // Records with forward references (e.g. in MASM output) are left with an
+  // empty hash by the first pass. Rehash them until all are resolved, as
+  // GloballyHashedType::hashTypes() does.
+  while (unresolvedRecords) {
+    unresolvedRecords = false;
+    uint32_t index = 0;
+    forEachTypeChecked(file->debugTypes, [&](const CVType &ty) {
+      GloballyHashedType &hash = hashVec[index++];
+      if (!hash.empty())
+        return;
+      GloballyHashedType newHash =
+          GloballyHashedType::hashType(ty, hashVec, hashVec);
+      if (newHash.empty())
+        unresolvedRecords = true;
+      else
+        hash = newHash;
+    });
+  }
+  assignGHashesFromVector(std::move(hashVec));
+}
+
 // Walk over file->debugTypes and fill in the isItemIndex bit vector.
 // TODO: Store this information in .debug$H so that we don't have to recompute
 // it. This is the main bottleneck slowing down parallel ghashing with one
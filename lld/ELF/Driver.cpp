@@ -1020,6 +1020,8 @@ static void readConfigs(opt::InputArgList &args) {
   config->checkSections =
       args.hasFlag(OPT_check_sections, OPT_no_check_sections, true);
   config->chroot = args.getLastArgValue(OPT_chroot);
+  config->coldSectionsLast =
+      args.hasFlag(OPT_cold_sections_last, OPT_no_cold_sections_last, false);
   config->compressDebugSections = getCompressDebugSections(args);
   config->cref = args.hasArg(OPT_cref);
   config->defineCommon = args.hasFlag(OPT_define_common, OPT_no_define_common,
@@ -2225,6 +2227,9 @@ template <class ELFT> void LinkerDriver::link(opt::InputArgList &args) {
   // appended to the Files vector.
   {
     llvm::TimeTraceScope timeScope("Parse input files");
+    // Decode and hash symbol names in parallel first. Symbol resolution
+    // below stays serial so that command line order precedence is kept.
+    parallelForEach(files, preparseFile);
     for (size_t i = 0; i < files.size(); ++i) {
       llvm::TimeTraceScope timeScope("Parse input files", files[i]->getName());
       parseFile(files[i]);
@@ -81,6 +81,7 @@
 #include "Symbols.h"
 #include "SyntheticSections.h"
 #include "Writer.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/BinaryFormat/ELF.h"
 #include "llvm/Object/ELF.h"
@@ -449,6 +450,17 @@ static void combineRelocHashes(unsigned cnt, InputSection *isec,
   isec->eqClass[(cnt + 1) % 2] = hash | (1U << 31);
 }
 
+// Returns a hash of the offsets and types of the given relocations. They are
+// compared by constantEq(), so sections whose relocations have different
+// shapes can never be folded and can start in different equivalence classes.
+template <class RelTy> static uint64_t getRelocShapeHash(ArrayRef<RelTy> rels) {
+  uint64_t hash = rels.size();
+  for (const RelTy &rel : rels)
+    hash = hash_combine(hash, uint64_t(rel.r_offset),
+                        rel.getType(config->isMips64EL));
+  return hash;
+}
+
 static void print(const Twine &s) {
   if (config->printIcfSections)
     message(s);
@@ -488,10 +500,17 @@ template <class ELFT> void ICF<ELFT>::run() {
     }
   }
 
-  // Initially, we use hash values to partition sections.
+  // Initially, we use hash values to partition sections. Everything that
+  // equalsConstant() compares outside of relocation targets goes into the
+  // hash, so that segregate() starts with classes that are as small as
+  // possible.
   parallelForEach(sections, [&](InputSection *s) {
+    uint64_t relocHash =
+        s->areRelocsRela ? getRelocShapeHash(s->template relas<ELFT>())
+                         : getRelocShapeHash(s->template rels<ELFT>());
+    uint64_t hash = hash_combine(xxHash64(s->data()), s->flags, relocHash);
     // Set MSB to 1 to avoid collisions with unique IDs.
-    s->eqClass[0] = xxHash64(s->data()) | (1U << 31);
+    s->eqClass[0] = hash | (1U << 31);
   });
 
   // Perform 2 rounds of relocation hash propagation. 2 is an empirical value to
@@ -233,6 +233,27 @@ void elf::parseFile(InputFile *file) {
   }
 }
 
+void elf::preparseFile(InputFile *file) {
+  if (file->kind() != InputFile::ObjKind)
+    return;
+  switch (file->ekind) {
+  case ELF32LEKind:
+    cast<ObjFile<ELF32LE>>(file)->hashGlobalSymbolNames();
+    return;
+  case ELF32BEKind:
+    cast<ObjFile<ELF32BE>>(file)->hashGlobalSymbolNames();
+    return;
+  case ELF64LEKind:
+    cast<ObjFile<ELF64LE>>(file)->hashGlobalSymbolNames();
+    return;
+  case ELF64BEKind:
+    cast<ObjFile<ELF64BE>>(file)->hashGlobalSymbolNames();
+    return;
+  default:
+    llvm_unreachable("unknown ELFT");
+  }
+}
+
 // Concatenates arguments to construct a string representing an error location.
 static std::string createFileLineMsg(StringRef path, unsigned line) {
   std::string filename = std::string(path::filename(path));
@@ -416,6 +437,21 @@ template <class ELFT> void ObjFile<ELFT>::parse(bool ignoreComdats) {
   initializeSymbols();
 }
 
+template <class ELFT> void ObjFile<ELFT>::hashGlobalSymbolNames() {
+  ArrayRef<Elf_Sym> eSyms = this->getGlobalELFSyms<ELFT>();
+  globalSymNames.reserve(eSyms.size());
+  for (const Elf_Sym &eSym : eSyms) {
+    Expected<StringRef> name = eSym.getName(this->stringTable);
+    if (!name) {
+      // Leave the diagnostic to initializeSymbols().
+      consumeError(name.takeError());
+      globalSymNames.clear();
+      return;
+    }
+    globalSymNames.emplace_back(SymbolTable::stripDefaultVersion(*name));
+  }
+}
+
 // Sections with SHT_GROUP and comdat bits define comdat section groups.
 // They are identified and deduplicated by group name. This function
 // returns a group name.
@@ -1097,8 +1133,11 @@ template <class ELFT> void ObjFile<ELFT>::initializeSymbols() {
         error(toString(this) + ": non-local symbol (" + Twine(i) +
               ") found at index < .symtab's sh_info (" + Twine(firstGlobal) +
               ")");
-      this->symbols[i] =
-          symtab->insert(CHECK(eSyms[i].getName(this->stringTable), this));
+      if (i >= firstGlobal && !globalSymNames.empty())
+        this->symbols[i] = symtab->insert(globalSymNames[i - firstGlobal]);
+      else
+        this->symbols[i] =
+            symtab->insert(CHECK(eSyms[i].getName(this->stringTable), this));
       continue;
     }
 
@@ -1130,6 +1169,8 @@ template <class ELFT> void ObjFile<ELFT>::initializeSymbols() {
                                        type, eSym.st_value, eSym.st_size, sec);
   }
 
+  SmallVector<CachedHashStringRef, 0>().swap(globalSymNames);
+
   // Symbol resolution of non-local symbols.
   SmallVector<unsigned, 32> undefineds;
   for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i) {
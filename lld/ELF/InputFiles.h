@@ -53,6 +53,10 @@ llvm::Optional<MemoryBufferRef> readFile(StringRef path);
 // Add symbols in File to the symbol table.
 void parseFile(InputFile *file);
 
+// Precompute per-file data used by parseFile() without touching the symbol
+// table. This is thread-safe and may be called for many files in parallel.
+void preparseFile(InputFile *file);
+
 // The root class of input files.
 class InputFile {
 public:
@@ -207,6 +211,11 @@ public:
 
   void parse(bool ignoreComdats = false);
 
+  // Decodes the names of global symbols and computes their hashes, so that
+  // parse() only needs to look them up in the symbol table. This does not
+  // access global state and is safe to call concurrently for different files.
+  void hashGlobalSymbolNames();
+
   StringRef getShtGroupSignature(ArrayRef<Elf_Shdr> sections,
                                  const Elf_Shdr &sec);
 
@@ -283,6 +292,11 @@ private:
   // .shstrtab contents.
   StringRef sectionStringTable;
 
+  // Names of global symbols with "@@<version>" stripped, along with their
+  // hashes. Filled by hashGlobalSymbolNames() and consumed by
+  // initializeSymbols(). Empty if hashGlobalSymbolNames() was not called.
+  SmallVector<llvm::CachedHashStringRef, 0> globalSymNames;
+
   // Debugging information to retrieve source file and line for error
   // reporting. Linker may find reasonable number of errors in a
   // single object file, so we cache debugging information in order to
@@ -374,6 +374,10 @@ static void replaceWithDefined(Symbol &sym, SectionBase *sec, uint64_t value,
 
   sym.pltIndex = old.pltIndex;
   sym.gotIndex = old.gotIndex;
+  sym.needsGot = old.needsGot;
+  sym.needsPlt = old.needsPlt;
+  sym.needsPltAddr = old.needsPltAddr;
+  sym.hasDirectReloc = old.hasDirectReloc;
   sym.verdefIndex = old.verdefIndex;
   sym.exportDynamic = true;
   sym.isUsedInRegularObj = true;
@@ -1082,19 +1086,9 @@ static void processRelocAux(InputSectionBase &sec, RelExpr expr, RelType type,
         errorOrWarn("symbol '" + toString(sym) +
                     "' cannot be preempted; recompile with -fPIE" +
                     getLocation(sec, sym, offset));
-      if (!sym.isInPlt())
-        addPltEntry(in.plt, in.gotPlt, in.relaPlt, target->pltRel, sym);
-      if (!sym.isDefined()) {
-        replaceWithDefined(
-            sym, in.plt,
-            target->pltHeaderSize + target->pltEntrySize * sym.pltIndex, 0);
-        if (config->emachine == EM_PPC) {
-          // PPC32 canonical PLT entries are at the beginning of .glink
-          cast<Defined>(sym).value = in.plt->headerSize;
-          in.plt->headerSize += 16;
-          cast<PPC32GlinkSection>(in.plt)->canonical_plts.push_back(&sym);
-        }
-      }
+      // The PLT entry is allocated, and the symbol redirected to it, by
+      // postScanRelocations().
+      sym.needsPlt = true;
       sym.needsPltAddr = true;
       sec.relocations.push_back({expr, type, offset, addend, &sym});
       return;
@@ -1438,8 +1432,9 @@ static void scanReloc(InputSectionBase &sec, OffsetGetter &getOffset, RelTy *&i,
   // case where the symbol isn't one of these.
   if (!sym.isGnuIFunc() || sym.isPreemptible) {
     // If a relocation needs PLT, we create PLT and GOTPLT slots for the symbol.
-    if (needsPlt(expr) && !sym.isInPlt())
-      addPltEntry(in.plt, in.gotPlt, in.relaPlt, target->pltRel, sym);
+    // The slots are allocated by postScanRelocations().
+    if (needsPlt(expr))
+      sym.needsPlt = true;
 
     // Create a GOT slot if a relocation needs GOT.
     if (needsGot(expr)) {
@@ -1452,8 +1447,8 @@ static void scanReloc(InputSectionBase &sec, OffsetGetter &getOffset, RelTy *&i,
         // for detailed description:
         // ftp://www.linux-mips.org/pub/linux/mips/doc/ABI/mipsabi.pdf
         in.mipsGot->addEntry(*sec.file, sym, addend, expr);
-      } else if (!sym.isInGot()) {
-        addGotEntry(sym);
+      } else {
+        sym.needsGot = true;
       }
     }
   } else {
@@ -1497,53 +1492,15 @@ static void scanReloc(InputSectionBase &sec, OffsetGetter &getOffset, RelTy *&i,
     //   correctly, the IRELATIVE relocations are stored in an array which a
     //   statically linked executable's startup code must enumerate using the
     //   linker-defined symbols __rela?_iplt_{start,end}.
-    if (!sym.isInPlt()) {
-      // Create PLT and GOTPLT slots for the symbol.
-      sym.isInIplt = true;
-
-      // Create a copy of the symbol to use as the target of the IRELATIVE
-      // relocation in the igotPlt. This is in case we make the PLT canonical
-      // later, which would overwrite the original symbol.
-      //
-      // FIXME: Creating a copy of the symbol here is a bit of a hack. All
-      // that's really needed to create the IRELATIVE is the section and value,
-      // so ideally we should just need to copy those.
-      auto *directSym = make<Defined>(cast<Defined>(sym));
-      addPltEntry(in.iplt, in.igotPlt, in.relaIplt, target->iRelativeRel,
-                  *directSym);
-      sym.pltIndex = directSym->pltIndex;
-    }
-    if (needsGot(expr)) {
-      // Redirect GOT accesses to point to the Igot.
-      //
-      // This field is also used to keep track of whether we ever needed a GOT
-      // entry. If we did and we make the PLT canonical later, we'll need to
-      // create a GOT entry pointing to the PLT entry for Sym.
-      sym.gotInIgot = true;
-    } else if (!needsPlt(expr)) {
-      // Make the ifunc's PLT entry canonical by changing the value of its
-      // symbol to redirect all references to point to it.
-      auto &d = cast<Defined>(sym);
-      d.section = in.iplt;
-      d.value = sym.pltIndex * target->ipltEntrySize;
-      d.size = 0;
-      // It's important to set the symbol type here so that dynamic loaders
-      // don't try to call the PLT as if it were an ifunc resolver.
-      d.type = STT_FUNC;
-
-      if (sym.gotInIgot) {
-        // We previously encountered a GOT generating reference that we
-        // redirected to the Igot. Now that the PLT entry is canonical we must
-        // clear the redirection to the Igot and add a GOT entry. As we've
-        // changed the symbol type to STT_FUNC future GOT generating references
-        // will naturally use this GOT entry.
-        //
-        // We don't need to worry about creating a MIPS GOT here because ifuncs
-        // aren't a thing on MIPS.
-        sym.gotInIgot = false;
-        addGotEntry(sym);
-      }
-    }
+    //
+    // The Iplt entry, and the Igot or GOT entry, are allocated by
+    // handleNonPreemptibleIfunc() once all relocations have been scanned.
+    if (needsGot(expr))
+      sym.needsGot = true;
+    else if (needsPlt(expr))
+      sym.needsPlt = true;
+    else
+      sym.hasDirectReloc = true;
   }
 
   processRelocAux<ELFT>(sec, expr, type, offset, sym, addend);
@@ -1623,6 +1580,87 @@ template <class ELFT> void elf::scanRelocations(InputSectionBase &s) {
     scanRelocs<ELFT>(s, s.rels<ELFT>());
 }
 
+// Allocate the Iplt entry of a non-preemptible ifunc referenced by a
+// relocation, see the comment in scanReloc(). Returns false if sym is not such
+// an ifunc.
+static bool handleNonPreemptibleIfunc(Symbol &sym) {
+  if (!sym.isGnuIFunc() || sym.isPreemptible || config->zIfuncNoplt)
+    return false;
+  if (!sym.needsGot && !sym.needsPlt && !sym.hasDirectReloc)
+    return true;
+
+  // Create PLT and GOTPLT slots for the symbol.
+  sym.isInIplt = true;
+
+  // Create a copy of the symbol to use as the target of the IRELATIVE
+  // relocation in the igotPlt. This is in case we make the PLT canonical
+  // below, which would overwrite the original symbol.
+  //
+  // FIXME: Creating a copy of the symbol here is a bit of a hack. All
+  // that's really needed to create the IRELATIVE is the section and value,
+  // so ideally we should just need to copy those.
+  auto *directSym = make<Defined>(cast<Defined>(sym));
+  addPltEntry(in.iplt, in.igotPlt, in.relaIplt, target->iRelativeRel,
+              *directSym);
+  sym.pltIndex = directSym->pltIndex;
+
+  if (sym.hasDirectReloc) {
+    // Make the ifunc's PLT entry canonical by changing the value of its
+    // symbol to redirect all references to point to it.
+    auto &d = cast<Defined>(sym);
+    d.section = in.iplt;
+    d.value = sym.pltIndex * target->ipltEntrySize;
+    d.size = 0;
+    // It's important to set the symbol type here so that dynamic loaders
+    // don't try to call the PLT as if it were an ifunc resolver.
+    d.type = STT_FUNC;
+
+    // GOT generating references then use a regular GOT entry pointing to the
+    // canonical PLT entry. We don't need to worry about creating a MIPS GOT
+    // here because ifuncs aren't a thing on MIPS.
+    if (sym.needsGot)
+      addGotEntry(sym);
+  } else if (sym.needsGot) {
+    // Redirect GOT accesses to point to the Igot.
+    sym.gotInIgot = true;
+  }
+  return true;
+}
+
+template <class ELFT> void elf::postScanRelocations() {
+  auto fn = [](Symbol &sym) {
+    if (handleNonPreemptibleIfunc(sym))
+      return;
+    if (sym.needsGot && !sym.isInGot())
+      addGotEntry(sym);
+    if (sym.needsPlt && !sym.isInPlt())
+      addPltEntry(in.plt, in.gotPlt, in.relaPlt, target->pltRel, sym);
+
+    // A non-PIC reference to a function in a shared object. Make its PLT entry
+    // canonical, see the comment in processRelocAux().
+    if (sym.needsPltAddr && !sym.isDefined()) {
+      replaceWithDefined(
+          sym, in.plt,
+          target->pltHeaderSize + target->pltEntrySize * sym.pltIndex, 0);
+      if (config->emachine == EM_PPC) {
+        // PPC32 canonical PLT entries are at the beginning of .glink
+        cast<Defined>(sym).value = in.plt->headerSize;
+        in.plt->headerSize += 16;
+        cast<PPC32GlinkSection>(in.plt)->canonical_plts.push_back(&sym);
+      }
+    }
+  };
+
+  // Visit symbols in symbol table order rather than in the order relocations
+  // were scanned, so that the GOT and PLT layout is deterministic. Local
+  // symbols may need GOT entries as well, but never regular PLT entries.
+  for (Symbol *sym : symtab->symbols())
+    fn(*sym);
+  for (InputFile *file : objectFiles)
+    for (Symbol *sym : cast<ObjFile<ELFT>>(file)->getLocalSymbols())
+      fn(*sym);
+}
+
 static bool mergeCmp(const InputSection *a, const InputSection *b) {
   // std::merge requires a strict weak ordering.
   if (a->outSecOff < b->outSecOff)
@@ -2146,6 +2184,11 @@ template void elf::scanRelocations<ELF32LE>(InputSectionBase &);
 template void elf::scanRelocations<ELF32BE>(InputSectionBase &);
 template void elf::scanRelocations<ELF64LE>(InputSectionBase &);
 template void elf::scanRelocations<ELF64BE>(InputSectionBase &);
+
+template void elf::postScanRelocations<ELF32LE>();
+template void elf::postScanRelocations<ELF32BE>();
+template void elf::postScanRelocations<ELF64LE>();
+template void elf::postScanRelocations<ELF64BE>();
 template void elf::reportUndefinedSymbols<ELF32LE>();
 template void elf::reportUndefinedSymbols<ELF32BE>();
 template void elf::reportUndefinedSymbols<ELF64LE>();
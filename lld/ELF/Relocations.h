@@ -127,6 +127,10 @@ template <class ELFT> void scanRelocations(InputSectionBase &);
 
 template <class ELFT> void reportUndefinedSymbols();
 
+// Allocate GOT and PLT entries requested by scanRelocations(). Call this once
+// all sections have been scanned.
+template <class ELFT> void postScanRelocations();
+
 void hexagonTLSSymbolUpdate(ArrayRef<OutputSection *> outputSections);
 bool hexagonNeedsTLSSymbol(ArrayRef<OutputSection *> outputSections);
 
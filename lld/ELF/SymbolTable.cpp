@@ -56,8 +56,7 @@ void SymbolTable::wrap(Symbol *sym, Symbol *real, Symbol *wrap) {
   real->isUsedInRegularObj = false;
 }
 
-// Find an existing symbol or create a new one.
-Symbol *SymbolTable::insert(StringRef name) {
+StringRef SymbolTable::stripDefaultVersion(StringRef name) {
   // <name>@@<version> means the symbol is the default version. In that
   // case <name>@@<version> will be used to resolve references to <name>.
   //
@@ -66,9 +65,17 @@ Symbol *SymbolTable::insert(StringRef name) {
   // StringRef::find(StringRef).
   size_t pos = name.find('@');
   if (pos != StringRef::npos && pos + 1 < name.size() && name[pos + 1] == '@')
-    name = name.take_front(pos);
+    return name.take_front(pos);
+  return name;
+}
 
-  auto p = symMap.insert({CachedHashStringRef(name), (int)symVector.size()});
+Symbol *SymbolTable::insert(StringRef name) {
+  return insert(CachedHashStringRef(stripDefaultVersion(name)));
+}
+
+// Find an existing symbol or create a new one.
+Symbol *SymbolTable::insert(CachedHashStringRef name) {
+  auto p = symMap.insert({name, (int)symVector.size()});
   int &symIndex = p.first->second;
   bool isNew = p.second;
 
@@ -80,7 +87,7 @@ Symbol *SymbolTable::insert(StringRef name) {
 
   // *sym was not initialized by a constructor. Fields that may get referenced
   // when it is a placeholder must be initialized here.
-  sym->setName(name);
+  sym->setName(name.val());
   sym->symbolKind = Symbol::PlaceholderKind;
   sym->versionId = VER_NDX_GLOBAL;
   sym->visibility = STV_DEFAULT;
@@ -47,6 +47,14 @@ public:
 
   Symbol *insert(StringRef name);
 
+  // Same as insert(StringRef), but the caller has already stripped any
+  // "@@<version>" suffix and computed the hash, e.g. in a parallel pass over
+  // input files. See ObjFile::hashGlobalSymbolNames.
+  Symbol *insert(llvm::CachedHashStringRef name);
+
+  // Returns <name> if name is of the form <name>@@<version>.
+  static StringRef stripDefaultVersion(StringRef name);
+
   Symbol *addSymbol(const Symbol &newSym);
 
   void scanVersionScript();
@@ -248,16 +248,11 @@ protected:
         type(type), stOther(stOther), symbolKind(k), visibility(stOther & 3),
         isUsedInRegularObj(!file || file->kind() == InputFile::ObjKind),
         exportDynamic(isExportDynamic(k, visibility)), inDynamicList(false),
-        canInline(false), referenced(false), traced(false), needsPltAddr(false),
-        isInIplt(false), gotInIgot(false), isPreemptible(false),
-        used(!config->gcSections), needsTocRestore(false),
-        scriptDefined(false) {}
+        canInline(false), referenced(false), traced(false), isInIplt(false),
+        gotInIgot(false), isPreemptible(false), used(!config->gcSections),
+        needsTocRestore(false), scriptDefined(false) {}
 
 public:
-  // True the symbol should point to its PLT entry.
-  // For SharedSymbol only.
-  uint8_t needsPltAddr : 1;
-
   // True if this symbol is in the Iplt sub-section of the Plt and the Igot
   // sub-section of the .got.plt or .got.
   uint8_t isInIplt : 1;
@@ -285,6 +280,25 @@ public:
   // The partition whose dynamic symbol table contains this symbol's definition.
   uint8_t partition = 1;
 
+  // The following are set by scanRelocations() and read by
+  // postScanRelocations(), which allocates GOT and PLT entries in symbol
+  // table order so that the layout does not depend on the order in which
+  // input sections were scanned. They are separate bytes rather than bit-fields
+  // so that setting one does not rewrite its neighbours.
+
+  // True if a relocation against this symbol needs a GOT or PLT entry.
+  bool needsGot = false;
+  bool needsPlt = false;
+
+  // True if the symbol should point to its PLT entry.
+  // For SharedSymbol only.
+  bool needsPltAddr = false;
+
+  // True if a relocation that needs neither a GOT nor a PLT entry references
+  // this symbol. Only used for non-preemptible ifuncs, whose PLT entry then
+  // becomes canonical.
+  bool hasDirectReloc = false;
+
   bool isSection() const { return type == llvm::ELF::STT_SECTION; }
   bool isTls() const { return type == llvm::ELF::STT_TLS; }
   bool isFunc() const { return type == llvm::ELF::STT_FUNC; }
@@ -641,25 +641,35 @@ template <class ELFT> void Writer<ELFT>::run() {
   {
     llvm::TimeTraceScope timeScope("Write output file");
     // Write the result down to a file.
-    openFile();
+    {
+      llvm::TimeTraceScope timeScope("Open output file");
+      openFile();
+    }
     if (errorCount())
       return;
 
-    if (!config->oFormatBinary) {
-      if (config->zSeparate != SeparateSegmentKind::None)
-        writeTrapInstr();
-      writeHeader();
-      writeSections();
-    } else {
-      writeSectionsBinary();
+    {
+      llvm::TimeTraceScope timeScope("Write sections");
+      if (!config->oFormatBinary) {
+        if (config->zSeparate != SeparateSegmentKind::None)
+          writeTrapInstr();
+        writeHeader();
+        writeSections();
+      } else {
+        writeSectionsBinary();
+      }
     }
 
     // Backfill .note.gnu.build-id section content. This is done at last
     // because the content is usually a hash value of the entire output file.
-    writeBuildId();
+    {
+      llvm::TimeTraceScope timeScope("Write build-id");
+      writeBuildId();
+    }
     if (errorCount())
       return;
 
+    llvm::TimeTraceScope commitScope("Commit output file");
     if (auto e = buffer->commit())
       error("failed to write to the output file: " + toString(std::move(e)));
   }
@@ -1456,6 +1466,15 @@ sortISDBySectionOrder(InputSectionDescription *isd,
     isd->sections.push_back(isec);
 }
 
+// Returns true if the compiler placed isec in a section for code that is
+// expected to run rarely, either because profile data says so (.text.unlikely)
+// or because it was split out of a hot function (-fsplit-machine-functions).
+static bool isColdSection(const InputSection *isec) {
+  StringRef name = isec->name;
+  return name == ".text.unlikely" || name.startswith(".text.unlikely.") ||
+         name.startswith(".text.split.");
+}
+
 static void sortSection(OutputSection *sec,
                         const DenseMap<const InputSectionBase *, int> &order) {
   StringRef name = sec->name;
@@ -1481,6 +1500,16 @@ static void sortSection(OutputSection *sec,
       if (auto *isd = dyn_cast<InputSectionDescription>(b))
         sortISDBySectionOrder(isd, order);
 
+  // With --cold-sections-last, keep the hot code ordered above together and
+  // move cold code to the end so that it does not dilute the i-cache and
+  // iTLB footprint of the hot path.
+  if (config->coldSectionsLast && (sec->flags & SHF_EXECINSTR))
+    for (BaseCommand *b : sec->sectionCommands)
+      if (auto *isd = dyn_cast<InputSectionDescription>(b))
+        std::stable_partition(
+            isd->sections.begin(), isd->sections.end(),
+            [](const InputSection *isec) { return !isColdSection(isec); });
+
   // Sort input sections by section name suffixes for
   // __attribute__((init_priority(N))).
   if (name == ".init_array" || name == ".fini_array") {
@@ -2016,6 +2045,7 @@ template <class ELFT> void Writer<ELFT>::finalizeSections() {
     if (!config->relocatable) {
       forEachRelSec(scanRelocations<ELFT>);
       reportUndefinedSymbols<ELFT>();
+      postScanRelocations<ELFT>();
     }
   }
 
@@ -2980,8 +3010,10 @@ template <class ELFT> void Writer<ELFT>::writeSections() {
       sec->writeTo<ELFT>(Out::bufferStart + sec->offset);
 
   for (OutputSection *sec : outputSections)
-    if (sec->type != SHT_REL && sec->type != SHT_RELA)
+    if (sec->type != SHT_REL && sec->type != SHT_RELA) {
+      llvm::TimeTraceScope timeScope("Write output section", sec->name);
       sec->writeTo<ELFT>(Out::bufferStart + sec->offset);
+    }
 
   // Finally, check that all dynamic relocation addends were written correctly.
   if (config->checkDynamicRelocs && config->writeAddends) {
@@ -17,6 +17,7 @@
 #include "UnwindInfoSection.h"
 #include "Writer.h"
 #include "lld/Common/Memory.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/xxhash.h"
 
@@ -84,9 +85,16 @@ bool ConcatInputSection::isHashableForICF() const {
 void ConcatInputSection::hashForICF() {
   assert(data.data()); // zeroFill section data has nullptr with non-zero size
   assert(icfEqClass[0] == 0); // don't overwrite a unique ID!
+  // Mix in the parts of the relocations that equalsConstant() compares, so
+  // that sections with the same bytes but different fixups start out in
+  // different equivalence classes.
+  uint64_t hash = xxHash64(data);
+  hash = hash_combine(hash, relocs.size());
+  for (const Reloc &r : relocs)
+    hash = hash_combine(hash, r.type, r.pcrel, r.length, r.offset, r.addend);
   // Turn-on the top bit to guarantee that valid hashes have no collisions
   // with the small-integer unique IDs for ICF-ineligible sections
-  icfEqClass[0] = xxHash64(data) | (1ull << 63);
+  icfEqClass[0] = hash | (1ull << 63);
 }
 
 void ConcatInputSection::foldIdentical(ConcatInputSection *copy) {
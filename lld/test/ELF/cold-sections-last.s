@@ -0,0 +1,60 @@
+# REQUIRES: x86
+## --cold-sections-last moves .text.unlikely.* and .text.split.* input sections
+## after the other input sections of their output section, keeping the order
+## of both groups, including the order given by --symbol-ordering-file.
+
+# RUN: llvm-mc -filetype=obj -triple=x86_64 %s -o %t.o
+
+# RUN: ld.lld %t.o -o %t
+# RUN: llvm-nm -n %t | FileCheck --check-prefix=DEFAULT %s
+# RUN: ld.lld %t.o --cold-sections-last --no-cold-sections-last -o %t
+# RUN: llvm-nm -n %t | FileCheck --check-prefix=DEFAULT %s
+
+# DEFAULT:      T _start
+# DEFAULT-NEXT: T cold1
+# DEFAULT-NEXT: T hot1
+# DEFAULT-NEXT: T split1
+# DEFAULT-NEXT: T hot2
+
+# RUN: ld.lld %t.o --cold-sections-last -o %t
+# RUN: llvm-nm -n %t | FileCheck --check-prefix=COLD %s
+
+# COLD:      T _start
+# COLD-NEXT: T hot1
+# COLD-NEXT: T hot2
+# COLD-NEXT: T cold1
+# COLD-NEXT: T split1
+
+# RUN: echo "hot2" > %t.order
+# RUN: echo "split1" >> %t.order
+# RUN: echo "hot1" >> %t.order
+# RUN: ld.lld %t.o --cold-sections-last --symbol-ordering-file=%t.order -o %t
+# RUN: llvm-nm -n %t | FileCheck --check-prefix=ORDER %s
+
+# ORDER:      T hot2
+# ORDER-NEXT: T hot1
+# ORDER-NEXT: T _start
+# ORDER-NEXT: T split1
+# ORDER-NEXT: T cold1
+
+.globl _start, hot1, hot2, cold1, split1
+
+.section .text._start,"ax",@progbits
+_start:
+  ret
+
+.section .text.unlikely.cold1,"ax",@progbits
+cold1:
+  ret
+
+.section .text.hot1,"ax",@progbits
+hot1:
+  ret
+
+.section .text.split.split1,"ax",@progbits
+split1:
+  ret
+
+.section .text.hot2,"ax",@progbits
+hot2:
+  ret
@@ -0,0 +1,36 @@
+# REQUIRES: x86
+## A non-preemptible ifunc referenced by both a GOT-generating and a direct
+## relocation gets a canonical PLT entry and a GOT entry pointing to it,
+## whichever of the two relocations is scanned first.
+
+# RUN: llvm-mc -filetype=obj -triple=x86_64 %s -o %t1.o
+# RUN: llvm-mc -filetype=obj -triple=x86_64 --defsym DIRECT_FIRST=1 %s -o %t2.o
+# RUN: ld.lld %t1.o -o %t1
+# RUN: ld.lld %t2.o -o %t2
+# RUN: llvm-readelf -S %t1 | FileCheck --check-prefix=SEC %s
+# RUN: llvm-readelf -S %t2 | FileCheck --check-prefix=SEC %s
+# RUN: llvm-readelf -r %t1 | FileCheck --check-prefix=RELOC %s
+# RUN: llvm-readelf -r %t2 | FileCheck --check-prefix=RELOC %s
+# RUN: llvm-readelf -s %t1 | FileCheck --check-prefix=SYM %s
+# RUN: llvm-readelf -s %t2 | FileCheck --check-prefix=SYM %s
+
+# SEC: .got PROGBITS
+
+# RELOC:     R_X86_64_IRELATIVE
+# RELOC-NOT: R_X86_64_IRELATIVE
+
+# SYM: 0 FUNC GLOBAL DEFAULT {{.+}} foo
+
+.globl _start, foo
+.type foo, @gnu_indirect_function
+foo:
+  ret
+
+_start:
+.ifdef DIRECT_FIRST
+  movabsq $foo, %rax
+  movq foo@GOTPCREL(%rip), %rax
+.else
+  movq foo@GOTPCREL(%rip), %rax
+  movabsq $foo, %rax
+.endif
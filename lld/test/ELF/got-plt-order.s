@@ -0,0 +1,41 @@
+# REQUIRES: x86
+## GOT and PLT entries are allocated in symbol table order once all relocations
+## have been scanned, not in the order in which relocations are seen: bbb is
+## referenced first but aaa comes first in the symbol table.
+
+# RUN: split-file %s %t
+# RUN: llvm-mc -filetype=obj -triple=x86_64 %t/a.s -o %t/a.o
+# RUN: llvm-mc -filetype=obj -triple=x86_64 %t/b.s -o %t/b.o
+# RUN: ld.lld -shared -soname=b %t/b.o -o %t/b.so
+# RUN: ld.lld %t/a.o %t/b.so -o %t/a
+# RUN: llvm-readobj -r %t/a | FileCheck %s
+
+# CHECK:      .rela.dyn {
+# CHECK-NEXT:   R_X86_64_GLOB_DAT aaa 0x0
+# CHECK-NEXT:   R_X86_64_GLOB_DAT bbb 0x0
+# CHECK-NEXT: }
+# CHECK:      .rela.plt {
+# CHECK-NEXT:   R_X86_64_JUMP_SLOT aaa 0x0
+# CHECK-NEXT:   R_X86_64_JUMP_SLOT bbb 0x0
+# CHECK-NEXT: }
+
+#--- a.s
+.globl _start, aaa, bbb
+_start:
+  ret
+
+.section .text.b,"ax",@progbits
+  call bbb@PLT
+  movq bbb@GOTPCREL(%rip), %rax
+
+.section .text.a,"ax",@progbits
+  call aaa@PLT
+  movq aaa@GOTPCREL(%rip), %rax
+
+#--- b.s
+.globl aaa, bbb
+.type aaa, @function
+.type bbb, @function
+aaa:
+bbb:
+  ret
@@ -113,10 +113,11 @@ void CodeSection::writeTo(uint8_t *buf) {
 
   // Write code section headers
   memcpy(buf, codeSectionHeader.data(), codeSectionHeader.size());
+}
 
-  // Write code section bodies
-  for (const InputChunk *chunk : functions)
-    chunk->writeTo(buf);
+void CodeSection::writeChunk(uint8_t *buf, size_t i) const {
+  // Write code section body
+  functions[i]->writeTo(buf + offset + header.size());
 }
 
 uint32_t CodeSection::getNumRelocations() const {
@@ -197,18 +198,21 @@ void DataSection::writeTo(uint8_t *buf) {
 
   // Write data section headers
   memcpy(buf, dataSectionHeader.data(), dataSectionHeader.size());
+}
 
-  for (const OutputSegment *segment : segments) {
-    if (segment->isBss)
-      continue;
-    // Write data segment header
-    uint8_t *segStart = buf + segment->sectionOffset;
-    memcpy(segStart, segment->header.data(), segment->header.size());
+void DataSection::writeChunk(uint8_t *buf, size_t i) const {
+  const OutputSegment *segment = segments[i];
+  if (segment->isBss)
+    return;
+  buf += offset + header.size();
 
-    // Write segment data payload
-    for (const InputChunk *chunk : segment->inputSegments)
-      chunk->writeTo(buf);
-  }
+  // Write data segment header
+  uint8_t *segStart = buf + segment->sectionOffset;
+  memcpy(segStart, segment->header.data(), segment->header.size());
+
+  // Write segment data payload
+  for (const InputChunk *chunk : segment->inputSegments)
+    chunk->writeTo(buf);
 }
 
 uint32_t DataSection::getNumRelocations() const {
@@ -289,11 +293,11 @@ void CustomSection::writeTo(uint8_t *buf) {
   memcpy(buf, header.data(), header.size());
   buf += header.size();
   memcpy(buf, nameData.data(), nameData.size());
-  buf += nameData.size();
+}
 
-  // Write custom sections payload
-  for (const InputChunk *section : inputSections)
-    section->writeTo(buf);
+void CustomSection::writeChunk(uint8_t *buf, size_t i) const {
+  // Write custom section payload
+  inputSections[i]->writeTo(buf + offset + header.size() + nameData.size());
 }
 
 uint32_t CustomSection::getNumRelocations() const {
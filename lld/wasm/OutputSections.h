@@ -38,7 +38,12 @@ public:
   virtual bool isNeeded() const { return true; }
   virtual size_t getSize() const = 0;
   virtual size_t getOffset() { return offset; }
+  // Writes the section to buf, except for the pieces counted by
+  // getNumChunks(), which are written separately by writeChunk() so that the
+  // writer can spread them across threads.
   virtual void writeTo(uint8_t *buf) = 0;
+  virtual size_t getNumChunks() const { return 0; }
+  virtual void writeChunk(uint8_t *buf, size_t i) const {}
   virtual void finalizeContents() = 0;
   virtual uint32_t getNumRelocations() const { return 0; }
   virtual void writeRelocations(raw_ostream &os) const {}
@@ -64,6 +69,8 @@ public:
 
   size_t getSize() const override { return header.size() + bodySize; }
   void writeTo(uint8_t *buf) override;
+  size_t getNumChunks() const override { return functions.size(); }
+  void writeChunk(uint8_t *buf, size_t i) const override;
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   bool isNeeded() const override { return functions.size() > 0; }
@@ -87,6 +94,8 @@ public:
 
   size_t getSize() const override { return header.size() + bodySize; }
   void writeTo(uint8_t *buf) override;
+  size_t getNumChunks() const override { return segments.size(); }
+  void writeChunk(uint8_t *buf, size_t i) const override;
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   bool isNeeded() const override;
@@ -120,6 +129,8 @@ public:
     return header.size() + nameData.size() + payloadSize;
   }
   void writeTo(uint8_t *buf) override;
+  size_t getNumChunks() const override { return inputSections.size(); }
+  void writeChunk(uint8_t *buf, size_t i) const override;
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   void finalizeContents() override;
@@ -208,9 +208,25 @@ void Writer::writeHeader() {
 
 void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
-  parallelForEach(outputSections, [buf](OutputSection *s) {
+
+  // Write each function body, data segment and custom section input chunk as
+  // a task of its own, alongside the section headers, rather than leaving a
+  // section to loop over its chunks.  A parallelForEach nested inside another
+  // one runs serially, so this is what lets a large code or debug info section
+  // use more than one thread.  Task 0 of each section is its writeTo(), and
+  // task i + 1 is its writeChunk(i).
+  std::vector<std::pair<OutputSection *, size_t>> tasks;
+  for (OutputSection *s : outputSections) {
     assert(s->isNeeded());
-    s->writeTo(buf);
+    for (size_t i = 0, e = s->getNumChunks(); i <= e; ++i)
+      tasks.emplace_back(s, i);
+  }
+
+  parallelForEach(tasks, [buf](const std::pair<OutputSection *, size_t> &t) {
+    if (t.second == 0)
+      t.first->writeTo(buf);
+    else
+      t.first->writeChunk(buf, t.second - 1);
   });
 }
 
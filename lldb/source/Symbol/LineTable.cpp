@@ -26,6 +26,11 @@ LineTable::LineTable(CompileUnit *comp_unit,
     : m_comp_unit(comp_unit), m_entries() {
   LineTable::Entry::LessThanBinaryPredicate less_than_bp(this);
   llvm::stable_sort(sequences, less_than_bp);
+  size_t num_entries = 0;
+  for (const auto &sequence : sequences)
+    num_entries +=
+        static_cast<LineSequenceImpl *>(sequence.get())->m_entries.size();
+  m_entries.reserve(num_entries);
   for (const auto &sequence : sequences) {
     LineSequenceImpl *seq = static_cast<LineSequenceImpl *>(sequence.get());
     m_entries.insert(m_entries.end(), seq->m_entries.begin(),
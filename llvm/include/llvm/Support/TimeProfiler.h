@@ -19,9 +19,12 @@ TimeTraceProfiler *getTimeTraceProfilerInstance();
 
 /// Initialize the time trace profiler.
 /// This sets up the global \p TimeTraceProfilerInstance
-/// variable to be the profiler instance.
+/// variable to be the profiler instance. If \p RecordMemoryUsage is set, every
+/// event also records how much the heap usage reported by
+/// sys::Process::GetMallocUsage() changed over its scope.
 void timeTraceProfilerInitialize(unsigned TimeTraceGranularity,
-                                 StringRef ProcName);
+                                 StringRef ProcName,
+                                 bool RecordMemoryUsage = false);
 
 /// Cleanup the time trace profiler, if it was initialized.
 void timeTraceProfilerCleanup();
@@ -5967,8 +5967,16 @@ std::vector<FunctionSummary::EdgeTy>
 ModuleSummaryIndexBitcodeReader::makeCallList(ArrayRef<uint64_t> Record,
                                               bool IsOldProfileFormat,
                                               bool HasProfile, bool HasRelBF) {
+  // Each edge takes one record field for the callee, plus one for its hotness
+  // or relative block frequency, if present. Call lists live for the whole
+  // thin link, so don't reserve room for more edges than there are.
+  unsigned FieldsPerEdge = 1;
+  if (IsOldProfileFormat)
+    FieldsPerEdge += HasProfile ? 2 : 1;
+  else if (HasProfile || HasRelBF)
+    FieldsPerEdge += 1;
   std::vector<FunctionSummary::EdgeTy> Ret;
-  Ret.reserve(Record.size());
+  Ret.reserve(Record.size() / FieldsPerEdge);
   for (unsigned I = 0, E = Record.size(); I != E; ++I) {
     CalleeInfo::HotnessType Hotness = CalleeInfo::HotnessType::Unknown;
     uint64_t RelBF = 0;
@@ -40,6 +40,12 @@
 
 using namespace llvm;
 
+#define DEBUG_TYPE "machine-function-splitter"
+
+STATISTIC(NumFunctionsSplit, "Number of functions split");
+STATISTIC(NumColdBlocks, "Number of blocks moved to the cold section");
+STATISTIC(NumColdInstrs, "Number of instructions moved to the cold section");
+
 // FIXME: This cutoff value is CPU dependent and should be moved to
 // TargetTransformInfo once we consider enabling this on other platforms.
 // The value is expressed as a ProfileSummaryInfo integer percentile cutoff.
@@ -82,6 +88,15 @@ static bool isColdBlock(const MachineBasicBlock &MBB,
                         const MachineBlockFrequencyInfo *MBFI,
                         ProfileSummaryInfo *PSI) {
   Optional<uint64_t> Count = MBFI->getBlockProfileCount(&MBB);
+  // Sample profiles are imprecise: a block without a count was merely not
+  // sampled, and percentile cutoffs over the summary are less reliable, so only
+  // split blocks whose count is confidently below the count threshold.
+  if (PSI->hasSampleProfile()) {
+    if (!Count.hasValue())
+      return false;
+    return (*Count < ColdCountThreshold);
+  }
+
   if (!Count.hasValue())
     return true;
 
@@ -150,6 +165,17 @@ bool MachineFunctionSplitter::runOnMachineFunction(MachineFunction &MF) {
   };
   llvm::sortBasicBlocksAndUpdateBranches(MF, Comparator);
 
+  bool Split = false;
+  for (const MachineBasicBlock &MBB : MF) {
+    if (MBB.getSectionID() != MBBSectionID::ColdSectionID)
+      continue;
+    Split = true;
+    ++NumColdBlocks;
+    NumColdInstrs += MBB.size();
+  }
+  if (Split)
+    ++NumFunctionsSplit;
+
   return true;
 }
 
@@ -369,17 +369,20 @@ getSymbols(MemoryBufferRef Buf, raw_ostream &SymNames, bool &HasObject) {
   std::vector<unsigned> Ret;
 
   // In the scenario when LLVMContext is populated SymbolicFile will contain a
-  // reference to it, thus SymbolicFile should be destroyed first.
-  LLVMContext Context;
+  // reference to it, thus SymbolicFile should be destroyed first. Only bitcode
+  // members need a context, so avoid creating one for every native object.
+  std::unique_ptr<LLVMContext> Context;
   std::unique_ptr<object::SymbolicFile> Obj;
 
   const file_magic Type = identify_magic(Buf.getBuffer());
   // Treat unsupported file types as having no symbols.
-  if (!object::SymbolicFile::isSymbolicFile(Type, &Context))
+  if (Type != file_magic::bitcode &&
+      !object::SymbolicFile::isSymbolicFile(Type, nullptr))
     return Ret;
   if (Type == file_magic::bitcode) {
+    Context = std::make_unique<LLVMContext>();
     auto ObjOrErr = object::SymbolicFile::createSymbolicFile(
-        Buf, file_magic::bitcode, &Context);
+        Buf, file_magic::bitcode, Context.get());
     if (!ObjOrErr)
       return ObjOrErr.takeError();
     Obj = std::move(*ObjOrErr);
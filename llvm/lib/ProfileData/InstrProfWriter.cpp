@@ -255,6 +255,9 @@ void InstrProfWriter::mergeRecordsFromWriter(InstrProfWriter &&IPW,
   for (auto &I : IPW.FunctionData)
     for (auto &Func : I.getValue())
       addRecord(I.getKey(), Func.first, std::move(Func.second), 1, Warn);
+  // The records have been moved out; release the now-empty entries so that
+  // merging many writers does not keep every source writer's tables alive.
+  IPW.FunctionData.clear();
 }
 
 bool InstrProfWriter::shouldEncodeData(const ProfilingData &PD) {
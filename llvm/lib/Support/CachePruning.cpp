@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/CachePruning.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Errc.h"
@@ -21,8 +22,8 @@
 
 #define DEBUG_TYPE "cache-pruning"
 
-#include <set>
 #include <system_error>
+#include <vector>
 
 using namespace llvm;
 
@@ -32,8 +33,8 @@ struct FileInfo {
   uint64_t Size;
   std::string Path;
 
-  /// Used to determine which files to prune first. Also used to determine
-  /// set membership, so must take into account all fields.
+  /// Used to determine which files to prune first. Takes all fields into
+  /// account so that the order is deterministic.
   bool operator<(const FileInfo &Other) const {
     return std::tie(Time, Other.Size, Path) <
            std::tie(Other.Time, Size, Other.Path);
@@ -201,7 +202,13 @@ bool llvm::pruneCache(StringRef Path, CachePruningPolicy Policy) {
 
   // Keep track of files to delete to get below the size limit.
   // Order by time of last use so that recently used files are preserved.
-  std::set<FileInfo> FileInfos;
+  // Collect them in a vector and sort once at the end: caches may hold
+  // millions of files, and a node-based set costs an allocation per file.
+  // Expiration alone does not need the list at all.
+  const bool NeedFileInfos = Policy.MaxSizeFiles ||
+                             Policy.MaxSizePercentageOfAvailableSpace > 0 ||
+                             Policy.MaxSizeBytes > 0;
+  std::vector<FileInfo> FileInfos;
   uint64_t TotalSize = 0;
 
   // Walk the entire directory cache, looking for unused files.
@@ -240,9 +247,12 @@ bool llvm::pruneCache(StringRef Path, CachePruningPolicy Policy) {
 
     // Leave it here for now, but add it to the list of size-based pruning.
     TotalSize += StatusOrErr->getSize();
-    FileInfos.insert({FileAccessTime, StatusOrErr->getSize(), File->path()});
+    if (NeedFileInfos)
+      FileInfos.push_back(
+          {FileAccessTime, StatusOrErr->getSize(), File->path()});
   }
 
+  llvm::sort(FileInfos);
   auto FileInfo = FileInfos.begin();
   size_t NumFiles = FileInfos.size();
 
@@ -51,6 +51,10 @@ struct Entry {
   TimePointType End;
   const std::string Name;
   const std::string Detail;
+  // Heap usage in bytes when the scope began, and how much it changed by the
+  // time the scope ended. Only set when recording memory usage.
+  size_t MallocAtStart = 0;
+  int64_t MallocDelta = 0;
 
   Entry(TimePointType &&S, TimePointType &&E, std::string &&N, std::string &&Dt)
       : Start(std::move(S)), End(std::move(E)), Name(std::move(N)),
@@ -74,22 +78,29 @@ struct Entry {
 } // namespace
 
 struct llvm::TimeTraceProfiler {
-  TimeTraceProfiler(unsigned TimeTraceGranularity = 0, StringRef ProcName = "")
+  TimeTraceProfiler(unsigned TimeTraceGranularity = 0, StringRef ProcName = "",
+                    bool RecordMemoryUsage = false)
       : BeginningOfTime(system_clock::now()), StartTime(steady_clock::now()),
         ProcName(ProcName), Pid(sys::Process::getProcessId()),
-        Tid(llvm::get_threadid()), TimeTraceGranularity(TimeTraceGranularity) {
+        Tid(llvm::get_threadid()), TimeTraceGranularity(TimeTraceGranularity),
+        RecordMemoryUsage(RecordMemoryUsage) {
     llvm::get_thread_name(ThreadName);
   }
 
   void begin(std::string Name, llvm::function_ref<std::string()> Detail) {
     Stack.emplace_back(steady_clock::now(), TimePointType(), std::move(Name),
                        Detail());
+    if (RecordMemoryUsage)
+      Stack.back().MallocAtStart = sys::Process::GetMallocUsage();
   }
 
   void end() {
     assert(!Stack.empty() && "Must call begin() first");
     Entry &E = Stack.back();
     E.End = steady_clock::now();
+    if (RecordMemoryUsage)
+      E.MallocDelta =
+          int64_t(sys::Process::GetMallocUsage()) - int64_t(E.MallocAtStart);
 
     // Check that end times monotonically increase.
     assert((Entries.empty() ||
@@ -149,8 +160,13 @@ struct llvm::TimeTraceProfiler {
         J.attribute("ts", StartUs);
         J.attribute("dur", DurUs);
         J.attribute("name", E.Name);
-        if (!E.Detail.empty()) {
-          J.attributeObject("args", [&] { J.attribute("detail", E.Detail); });
+        if (!E.Detail.empty() || RecordMemoryUsage) {
+          J.attributeObject("args", [&] {
+            if (!E.Detail.empty())
+              J.attribute("detail", E.Detail);
+            if (RecordMemoryUsage)
+              J.attribute("malloc delta", E.MallocDelta);
+          });
         }
       });
     };
@@ -258,14 +274,20 @@ struct llvm::TimeTraceProfiler {
 
   // Minimum time granularity (in microseconds)
   const unsigned TimeTraceGranularity;
+
+  // Whether to record the change in heap usage of each scope.
+  const bool RecordMemoryUsage;
 };
 
 void llvm::timeTraceProfilerInitialize(unsigned TimeTraceGranularity,
-                                       StringRef ProcName) {
+                                       StringRef ProcName,
+                                       bool RecordMemoryUsage) {
   assert(TimeTraceProfilerInstance == nullptr &&
          "Profiler should not be initialized");
-  TimeTraceProfilerInstance = new TimeTraceProfiler(
-      TimeTraceGranularity, llvm::sys::path::filename(ProcName));
+  TimeTraceProfilerInstance =
+      new TimeTraceProfiler(TimeTraceGranularity,
+                            llvm::sys::path::filename(ProcName),
+                            RecordMemoryUsage);
 }
 
 // Removes all TimeTraceProfilerInstances.
@@ -134,6 +134,11 @@ STATISTIC(NumOpenMPTargetRegionKernelsCustomStateMachineWithoutFallback,
 STATISTIC(
     NumOpenMPParallelRegionsReplacedInGPUStateMachine,
     "Number of OpenMP parallel regions replaced with ID in GPU state machines");
+STATISTIC(NumOpenMPTargetRegionKernelsSPMDIncompatible,
+          "Number of OpenMP target region entry points (=kernels) kept in "
+          "generic-mode because of SPMD-incompatible side effects");
+STATISTIC(NumOpenMPGuardedRegions,
+          "Number of guarded regions created to execute kernels in SPMD-mode");
 STATISTIC(NumOpenMPParallelRegionsMerged,
           "Number of OpenMP parallel regions merged");
 STATISTIC(NumBytesMovedToSharedMemory,
@@ -3076,6 +3081,7 @@ struct AAKernelInfoFunction : AAKernelInfo {
                           << *NonCompatibleI << "\n");
       }
 
+      ++NumOpenMPTargetRegionKernelsSPMDIncompatible;
       return false;
     }
 
@@ -3288,6 +3294,7 @@ struct AAKernelInfoFunction : AAKernelInfo {
 
     for (auto &GR : GuardedRegions)
       CreateGuardedRegion(GR.first, GR.second);
+    NumOpenMPGuardedRegions += GuardedRegions.size();
 
     // Adjust the global exec mode flag that tells the runtime what mode this
     // kernel is executed in.
@@ -116,6 +116,13 @@ using namespace llvm::PatternMatch;
 
 STATISTIC(NumWorklistIterations,
           "Number of instruction combining iterations performed");
+STATISTIC(NumOneIteration, "Number of functions with one iteration");
+STATISTIC(NumTwoIterations, "Number of functions with two iterations");
+STATISTIC(NumThreeIterations, "Number of functions with three iterations");
+STATISTIC(NumFourOrMoreIterations,
+          "Number of functions with four or more iterations");
+STATISTIC(NumIterationLimitReached,
+          "Number of functions that hit the iteration limit");
 
 STATISTIC(NumCombined , "Number of insts combined");
 STATISTIC(NumConstProp, "Number of constant folds");
@@ -4137,7 +4144,9 @@ static bool combineInstructionsOverFunction(
       LLVM_DEBUG(dbgs() << "\n\n[IC] Iteration limit #" << MaxIterations
                         << " on " << F.getName()
                         << " reached; stopping before reaching a fixpoint\n");
-      break;
+      // Such functions are not counted in the per-iteration buckets below.
+      ++NumIterationLimitReached;
+      return MadeIRChange;
     }
 
     LLVM_DEBUG(dbgs() << "\n\nINSTCOMBINE ITERATION #" << Iteration << " on "
@@ -4155,6 +4164,18 @@ static bool combineInstructionsOverFunction(
     MadeIRChange = true;
   }
 
+  // Only functions that reached a fixpoint get here. The last iteration only
+  // confirms the fixpoint, so every function with more than one iteration
+  // revisited the whole function at least once.
+  if (Iteration == 1)
+    ++NumOneIteration;
+  else if (Iteration == 2)
+    ++NumTwoIterations;
+  else if (Iteration == 3)
+    ++NumThreeIterations;
+  else
+    ++NumFourOrMoreIterations;
+
   return MadeIRChange;
 }
 
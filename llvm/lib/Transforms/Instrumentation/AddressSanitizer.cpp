@@ -437,6 +437,8 @@ STATISTIC(NumOptimizedAccessesToGlobalVar,
           "Number of optimized accesses to global vars");
 STATISTIC(NumOptimizedAccessesToStackVar,
           "Number of optimized accesses to stack vars");
+STATISTIC(NumOptimizedAccessesToSameTemp,
+          "Number of accesses not instrumented as redundant in their block");
 
 namespace {
 
@@ -2895,11 +2897,15 @@ bool AddressSanitizer::instrumentFunction(Function &F,
             // instrumented the full object. But don't add to TempsToInstrument
             // because we might get another load/store with a different mask.
             if (Operand.MaybeMask) {
-              if (TempsToInstrument.count(Ptr))
+              if (TempsToInstrument.count(Ptr)) {
+                ++NumOptimizedAccessesToSameTemp;
                 continue; // We've seen this (whole) temp in the current BB.
+              }
             } else {
-              if (!TempsToInstrument.insert(Ptr).second)
+              if (!TempsToInstrument.insert(Ptr).second) {
+                ++NumOptimizedAccessesToSameTemp;
                 continue; // We've seen this temp in the current BB.
+              }
             }
           }
           OperandsToInstrument.push_back(Operand);
@@ -14,6 +14,7 @@
 #include "llvm/Transforms/Instrumentation/HWAddressSanitizer.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Triple.h"
@@ -61,6 +62,9 @@ using namespace llvm;
 
 #define DEBUG_TYPE "hwasan"
 
+STATISTIC(NumSameBlockChecksSkipped,
+          "Number of checks skipped as redundant within a basic block");
+
 const char kHwasanModuleCtorName[] = "hwasan.module_ctor";
 const char kHwasanNoteName[] = "hwasan.note";
 const char kHwasanInitName[] = "__hwasan_init";
@@ -120,6 +124,12 @@ static cl::opt<bool>
                      cl::Hidden, cl::desc("Use Stack Safety analysis results"),
                      cl::Optional);
 
+static cl::opt<bool> ClOptSameBlock(
+    "hwasan-opt-same-block",
+    cl::desc("skip checks of an address already checked with at least the "
+             "same access size earlier in the basic block"),
+    cl::Hidden, cl::init(false));
+
 static cl::opt<size_t> ClMaxLifetimes(
     "hwasan-max-lifetimes-for-alloca", cl::Hidden, cl::init(3),
     cl::ReallyHidden,
@@ -292,7 +302,7 @@ public:
                                  Instruction *InsertBefore);
   bool ignoreMemIntrinsic(MemIntrinsic *MI);
   void instrumentMemIntrinsic(MemIntrinsic *MI);
-  bool instrumentMemAccess(InterestingMemoryOperand &O);
+  bool instrumentMemAccess(InterestingMemoryOperand &O, bool SkipCheck);
   bool ignoreAccess(Instruction *Inst, Value *Ptr);
   void getInterestingMemoryOperands(
       Instruction *I, SmallVectorImpl<InterestingMemoryOperand> &Interesting);
@@ -1023,7 +1033,8 @@ void HWAddressSanitizer::instrumentMemIntrinsic(MemIntrinsic *MI) {
   MI->eraseFromParent();
 }
 
-bool HWAddressSanitizer::instrumentMemAccess(InterestingMemoryOperand &O) {
+bool HWAddressSanitizer::instrumentMemAccess(InterestingMemoryOperand &O,
+                                             bool SkipCheck) {
   Value *Addr = O.getPtr();
 
   LLVM_DEBUG(dbgs() << "Instrumenting: " << O.getInsn() << "\n");
@@ -1031,6 +1042,13 @@ bool HWAddressSanitizer::instrumentMemAccess(InterestingMemoryOperand &O) {
   if (O.MaybeMask)
     return false; // FIXME
 
+  // The access was already checked earlier in the block, but the pointer
+  // operand still has to be untagged where the target does not ignore tags.
+  if (SkipCheck) {
+    untagPointerOperand(O.getInsn(), Addr);
+    return true;
+  }
+
   IRBuilder<> IRB(O.getInsn());
   if (isPowerOf2_64(O.TypeSize) &&
       (O.TypeSize / 8 <= (1ULL << (kNumberOfAccessSizes - 1))) &&
@@ -1502,14 +1520,26 @@ bool HWAddressSanitizer::sanitizeFunction(
   LLVM_DEBUG(dbgs() << "Function: " << F.getName() << "\n");
 
   SmallVector<InterestingMemoryOperand, 16> OperandsToInstrument;
+  // Parallel to OperandsToInstrument: true if the operand needs no check.
+  SmallVector<bool, 16> SkipCheck;
   SmallVector<MemIntrinsic *, 16> IntrinToInstrument;
   MapVector<AllocaInst *, AllocaInfo> AllocasToInstrument;
   SmallVector<Instruction *, 8> RetVec;
   SmallVector<Instruction *, 8> LandingPadVec;
   SmallVector<Instruction *, 4> UnrecognizedLifetimes;
   DenseMap<AllocaInst *, std::vector<DbgVariableIntrinsic *>> AllocaDbgMap;
+  // Largest access size already checked per address in the current block.
+  // Without recovery, a check that passed for [Ptr, Ptr + Size) implies the
+  // same tag matches for any smaller access at Ptr until a call may retag it.
+  DenseMap<Value *, uint64_t> CheckedAccessSizes;
+  bool OptSameBlock = ClOptSameBlock && !Recover;
   for (auto &BB : F) {
+    CheckedAccessSizes.clear();
     for (auto &Inst : BB) {
+      // Calls, including lifetime markers, may retag memory.
+      if (OptSameBlock && isa<CallBase>(Inst) && !isa<DbgInfoIntrinsic>(Inst))
+        CheckedAccessSizes.clear();
+
       if (InstrumentStack) {
         if (AllocaInst *AI = dyn_cast<AllocaInst>(&Inst)) {
           if (isInterestingAlloca(*AI))
@@ -1550,7 +1580,28 @@ bool HWAddressSanitizer::sanitizeFunction(
       if (InstrumentLandingPads && isa<LandingPadInst>(Inst))
         LandingPadVec.push_back(&Inst);
 
-      getInterestingMemoryOperands(&Inst, OperandsToInstrument);
+      if (OptSameBlock) {
+        SmallVector<InterestingMemoryOperand, 1> InterestingOperands;
+        getInterestingMemoryOperands(&Inst, InterestingOperands);
+        for (InterestingMemoryOperand &Operand : InterestingOperands) {
+          Value *Ptr = Operand.getPtr();
+          bool Skip = false;
+          if (!Operand.MaybeMask) {
+            uint64_t &CheckedSize = CheckedAccessSizes[Ptr];
+            if (CheckedSize >= Operand.TypeSize) {
+              ++NumSameBlockChecksSkipped;
+              Skip = true;
+            } else {
+              CheckedSize = Operand.TypeSize;
+            }
+          }
+          OperandsToInstrument.push_back(Operand);
+          SkipCheck.push_back(Skip);
+        }
+      } else {
+        getInterestingMemoryOperands(&Inst, OperandsToInstrument);
+        SkipCheck.resize(OperandsToInstrument.size(), false);
+      }
 
       if (MemIntrinsic *MI = dyn_cast<MemIntrinsic>(&Inst))
         if (!ignoreMemIntrinsic(MI))
@@ -1629,8 +1680,8 @@ bool HWAddressSanitizer::sanitizeFunction(
     }
   }
 
-  for (auto &Operand : OperandsToInstrument)
-    instrumentMemAccess(Operand);
+  for (size_t I = 0, E = OperandsToInstrument.size(); I != E; ++I)
+    instrumentMemAccess(OperandsToInstrument[I], SkipCheck[I]);
 
   if (ClInstrumentMemIntrinsics && !IntrinToInstrument.empty()) {
     for (auto Inst : IntrinToInstrument)
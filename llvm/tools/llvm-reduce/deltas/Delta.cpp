@@ -14,11 +14,12 @@
 
 #include "Delta.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/IR/Verifier.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/MD5.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Transforms/Utils/Cloning.h"
-#include <fstream>
 #include <set>
 
 using namespace llvm;
@@ -29,8 +30,31 @@ static cl::opt<bool> AbortOnInvalidReduction(
 
 void writeOutput(llvm::Module *M, llvm::StringRef Message);
 
-bool isReduced(Module &M, TestRunner &Test, SmallString<128> &CurrentFilepath) {
+/// Results of the interesting-ness test, keyed by the MD5 of the textual IR
+/// that was tested. Delta passes regularly produce a module that has been
+/// tested before (e.g. the unchanged program at the start of every pass, or
+/// a chunk whose targets are already gone), and running the test is usually
+/// far more expensive than printing and hashing the module.
+static StringMap<bool> TestResultCache;
+
+bool isReduced(Module &M, TestRunner &Test, size_t *NumLines = nullptr) {
+  std::string IR;
+  raw_string_ostream IRStream(IR);
+  M.print(IRStream, /*AnnotationWriter=*/nullptr);
+  IRStream.flush();
+  if (NumLines)
+    *NumLines = count(IR, '\n');
+
+  MD5 Hasher;
+  Hasher.update(IR);
+  MD5::MD5Result Hash;
+  Hasher.final(Hash);
+  auto CacheEntry = TestResultCache.try_emplace(Hash.digest(), false);
+  if (!CacheEntry.second)
+    return CacheEntry.first->second;
+
   // Write Module to tmp file
+  SmallString<128> CurrentFilepath;
   int FD;
   std::error_code EC =
       sys::fs::createTemporaryFile("llvm-reduce", "ll", FD, CurrentFilepath);
@@ -40,7 +64,7 @@ bool isReduced(Module &M, TestRunner &Test, SmallString<128> &CurrentFilepath) {
   }
 
   ToolOutputFile Out(CurrentFilepath, FD);
-  M.print(Out.os(), /*AnnotationWriter=*/nullptr);
+  Out.os() << IR;
   Out.os().close();
   if (Out.os().has_error()) {
     errs() << "Error emitting bitcode to file '" << CurrentFilepath << "'!\n";
@@ -48,19 +72,9 @@ bool isReduced(Module &M, TestRunner &Test, SmallString<128> &CurrentFilepath) {
   }
 
   // Current Chunks aren't interesting
-  return Test.run(CurrentFilepath);
-}
-
-/// Counts the amount of lines for a given file
-static int getLines(StringRef Filepath) {
-  int Lines = 0;
-  std::string CurrLine;
-  std::ifstream FileStream{std::string(Filepath)};
-
-  while (std::getline(FileStream, CurrLine))
-    ++Lines;
-
-  return Lines;
+  bool Interesting = Test.run(CurrentFilepath);
+  CacheEntry.first->second = Interesting;
+  return Interesting;
 }
 
 /// Splits Chunks in half and prints them.
@@ -106,8 +120,7 @@ void llvm::runDeltaPass(
   }
 
   if (Module *Program = Test.getProgram()) {
-    SmallString<128> CurrentFilepath;
-    if (!isReduced(*Program, Test, CurrentFilepath)) {
+    if (!isReduced(*Program, Test)) {
       errs() << "\nInput isn't interesting! Verify interesting-ness test\n";
       exit(1);
     }
@@ -160,8 +173,8 @@ void llvm::runDeltaPass(
       for (const Chunk &C : UninterestingChunks)
         C.print();
 
-      SmallString<128> CurrentFilepath;
-      if (!isReduced(*Clone, Test, CurrentFilepath)) {
+      size_t NumLines;
+      if (!isReduced(*Clone, Test, &NumLines)) {
         // Program became non-reduced, so this chunk appears to be interesting.
         errs() << "\n";
         continue;
@@ -170,7 +183,7 @@ void llvm::runDeltaPass(
       FoundAtLeastOneNewUninterestingChunkWithCurrentGranularity = true;
       UninterestingChunks.insert(ChunkToCheckForUninterestingness);
       ReducedProgram = std::move(Clone);
-      errs() << " **** SUCCESS | lines: " << getLines(CurrentFilepath) << "\n";
+      errs() << " **** SUCCESS | lines: " << NumLines << "\n";
       writeOutput(ReducedProgram.get(), "Saved new best reduction to ");
     }
     // Delete uninteresting chunks
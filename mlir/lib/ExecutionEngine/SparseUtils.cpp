@@ -71,10 +71,13 @@ namespace {
 ///   ({i}, a[i])
 /// and a rank-5 tensor element like
 ///   ({i,j,k,l,m}, a[i,j,k,l,m])
+/// The indices are not owned by the element; they point into the shared index
+/// pool of the enclosing SparseTensorCOO, which avoids a heap allocation per
+/// element.
 template <typename V>
 struct Element {
-  Element(const std::vector<uint64_t> &ind, V val) : indices(ind), value(val){};
-  std::vector<uint64_t> indices;
+  Element(uint64_t *ind, V val) : indices(ind), value(val){};
+  uint64_t *indices; // pointer into shared index pool
   V value;
 };
 
@@ -88,18 +91,39 @@ struct SparseTensorCOO {
 public:
   SparseTensorCOO(const std::vector<uint64_t> &szs, uint64_t capacity)
       : sizes(szs) {
-    if (capacity)
+    if (capacity) {
       elements.reserve(capacity);
+      indices.reserve(capacity * getRank());
+    }
   }
   /// Adds element as indices and value.
   void add(const std::vector<uint64_t> &ind, V val) {
     assert(getRank() == ind.size());
-    for (uint64_t r = 0, rank = getRank(); r < rank; r++)
+    uint64_t *base = indices.data();
+    uint64_t size = indices.size();
+    for (uint64_t r = 0, rank = getRank(); r < rank; r++) {
       assert(ind[r] < sizes[r]); // within bounds
-    elements.emplace_back(ind, val);
+      indices.push_back(ind[r]);
+    }
+    // The base only changes if the index pool was reallocated, in which case
+    // all previous pointers into the pool must be corrected. With a proper
+    // initial capacity this never happens, and otherwise the doubling rule
+    // keeps the overhead amortized linear.
+    uint64_t *newBase = indices.data();
+    if (newBase != base) {
+      for (Element<V> &e : elements)
+        e.indices = newBase + (e.indices - base);
+    }
+    elements.emplace_back(newBase + size, val);
   }
   /// Sorts elements lexicographically by index.
-  void sort() { std::sort(elements.begin(), elements.end(), lexOrder); }
+  void sort() {
+    uint64_t rank = getRank();
+    std::sort(elements.begin(), elements.end(),
+              [rank](const Element<V> &e1, const Element<V> &e2) {
+                return lexOrder(rank, e1, e2);
+              });
+  }
   /// Returns rank.
   uint64_t getRank() const { return sizes.size(); }
   /// Getter for sizes array.
@@ -123,9 +147,9 @@ public:
 
 private:
   /// Returns true if indices of e1 < indices of e2.
-  static bool lexOrder(const Element<V> &e1, const Element<V> &e2) {
-    assert(e1.indices.size() == e2.indices.size());
-    for (uint64_t r = 0, rank = e1.indices.size(); r < rank; r++) {
+  static bool lexOrder(uint64_t rank, const Element<V> &e1,
+                       const Element<V> &e2) {
+    for (uint64_t r = 0; r < rank; r++) {
       if (e1.indices[r] == e2.indices[r])
         continue;
       return e1.indices[r] < e2.indices[r];
@@ -134,6 +158,7 @@ private:
   }
   std::vector<uint64_t> sizes; // per-rank dimension sizes
   std::vector<Element<V>> elements;
+  std::vector<uint64_t> indices; // shared index pool
 };
 
 /// Abstract base class of sparse tensor storage. Note that we use
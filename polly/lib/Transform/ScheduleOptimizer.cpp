@@ -52,6 +52,7 @@
 #include "polly/MatmulOptimizer.h"
 #include "polly/Options.h"
 #include "polly/ScheduleTreeTransform.h"
+#include "polly/Support/GICHelper.h"
 #include "polly/Support/ISLOStream.h"
 #include "llvm/ADT/Sequence.h"
 #include "llvm/ADT/Statistic.h"
@@ -188,6 +189,12 @@ static cl::opt<bool>
                             "tiling (requires -polly-reschedule)"),
                    cl::init(true), cl::ZeroOrMore, cl::cat(PollyCategory));
 
+static cl::opt<int> ScheduleComputeOut(
+    "polly-schedule-computeout",
+    cl::desc("Bound the scheduler by a maximal amount of computational steps "
+             "(0 means no bound)"),
+    cl::Hidden, cl::init(300000), cl::ZeroOrMore, cl::cat(PollyCategory));
+
 static cl::opt<bool> OptimizedScops(
     "polly-optimized-scops",
     cl::desc("Polly - Dump polyhedral description of Scops optimized with "
@@ -197,6 +204,8 @@ static cl::opt<bool> OptimizedScops(
 
 STATISTIC(ScopsProcessed, "Number of scops processed");
 STATISTIC(ScopsRescheduled, "Number of scops rescheduled");
+STATISTIC(ScopsComputedOut,
+          "Number of scops whose rescheduling exceeded the compute budget");
 STATISTIC(ScopsOptimized, "Number of scops optimized");
 
 STATISTIC(NumAffineLoopsOptimized, "Number of affine loops optimized");
@@ -825,11 +834,23 @@ static bool runIslScheduleOptimizer(
     SC = SC.set_proximity(Proximity);
     SC = SC.set_validity(Validity);
     SC = SC.set_coincidence(Validity);
-    Schedule = SC.compute_schedule();
+
+    {
+      IslMaxOperationsGuard MaxOpGuard(Ctx, ScheduleComputeOut);
+      Schedule = SC.compute_schedule();
+
+      if (MaxOpGuard.hasQuotaExceeded()) {
+        LLVM_DEBUG(
+            dbgs() << "Schedule optimizer calculation exceeds ISL quota\n");
+        ScopsComputedOut++;
+        Schedule = {};
+      }
+    }
     isl_options_set_on_error(Ctx, OnErrorStatus);
 
     ScopsRescheduled++;
-    LLVM_DEBUG(printSchedule(dbgs(), Schedule, "After rescheduling"));
+    if (!Schedule.is_null())
+      LLVM_DEBUG(printSchedule(dbgs(), Schedule, "After rescheduling"));
   }
 
   walkScheduleTreeForStatistics(Schedule, 1);